@@ -0,0 +1,95 @@
+//-----------------------------------------------------------------------------
+//
+//  Arena.h
+//
+//  Swallowtail Scratch Memory Firmware
+//  AVR (ATmega168PB) Shared SRAM Overlay Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+//The Maple capture buffer is the largest thing in SRAM and only holds data from the start of a capture to the end of its
+//decode. Everything else that needs a big scratch buffer for a moment borrows it in between, one phase at a time
+#define ARENA ((uint8_t *)maplebuf) //Start of the shared memory (maplebuf is in MapleBus.h, these only expand where they are used)
+#define ARENA_SIZE MAPLE_BUF_SIZE
+
+//Phases, each one owns the whole arena
+#define ARENA_FREE 0 //Nobody is using it
+#define ARENA_MAPLE_RX 1 //Capture and decode of a reply (maple_receiveFrame)
+#define ARENA_MAPLE_TX 2 //Frame put together by maple_sendFrame until it is on the wire
+#define ARENA_VMU 3 //LCD block rendered or decompressed and sent (VMU.h, HUD.h)
+#define ARENA_RADIO 4 //nRF24L01 payload read back (nRF24L01_Transfer, taken out right away by the caller)
+#define ARENA_DEVINFO 5 //Device info reply decoded into a DeviceInfo (Dreamcast.h, only while the prober looks at it)
+
+//Count claims made while another phase still held the arena (sent in the STATS_REPORT frame of main.c)
+#define ARENA_CHECK
+
+//Fail the build if a phase wants more than the arena has
+#define ARENA_FITS(size, what) _Static_assert((size) <= ARENA_SIZE, what " does not fit in the arena")
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+
+/******************* Globals *****************************/
+
+static uint8_t arena_phase = ARENA_FREE; //Phase holding the arena
+#ifdef ARENA_CHECK
+static uint16_t arena_conflicts = 0; //Claims that found another phase still holding it
+#endif
+
+/******************** Functions **************************/
+
+//Take the arena for a phase (whatever was in it is lost)
+void Arena_Claim(uint8_t phase){
+#ifdef ARENA_CHECK
+	if(arena_phase != ARENA_FREE && arena_phase != phase){
+		arena_conflicts++;
+	}
+#endif
+	arena_phase = phase;
+	return; //Return to call point
+}
+
+//Give the arena back once the phase is done with its data
+void Arena_Release(uint8_t phase){
+	if(arena_phase == phase){
+		arena_phase = ARENA_FREE;
+	}
+	return; //Return to call point
+}
+
+#ifdef ARENA_CHECK
+//Claims that overlapped another phase since power up (should stay 0)
+uint16_t Arena_Conflicts(){
+	return arena_conflicts;
+}
+#endif
+
+/******************** Interrupt Service Routines *********/
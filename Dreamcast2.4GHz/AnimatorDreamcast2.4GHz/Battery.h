@@ -0,0 +1,70 @@
+//-----------------------------------------------------------------------------
+//
+//  Battery.h
+//
+//  Swallowtail Battery Monitor Firmware
+//  AVR (ATmega168PB) Supply Voltage Measurement Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+#define BATTERY_BANDGAP_MV 1100 //Internal reference measured against AVCC (typical, see the datasheet for the spread)
+#define BATTERY_MUX_BANDGAP ((1<<MUX3) | (1<<MUX2) | (1<<MUX1)) //MUX3:0 = 1110
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+
+/******************* Globals *****************************/
+
+static uint16_t battery_mv = 0; //Last supply voltage measured (0 until the first conversion is done)
+
+/******************** Functions **************************/
+
+//Measure the bandgap against AVCC so the supply voltage can be worked out without an external divider
+void Battery_init(){
+	ADMUX = (1<<REFS0) | BATTERY_MUX_BANDGAP;
+	//ADC clock at F_CPU/128 (125kHz at 16MHz), start the first conversion
+	ADCSRA = (1<<ADEN) | (1<<ADSC) | (1<<ADPS2) | (1<<ADPS1) | (1<<ADPS0);
+	return; //Return to call point
+}
+
+//Supply voltage in millivolts. Never waits: picks up a finished conversion and starts the next one
+uint16_t Battery_Millivolts(){
+	if(!BIT_SET(ADCSRA, ADSC)){
+		uint16_t adc = ADC;
+		if(adc){
+			battery_mv = (uint16_t)(((uint32_t)BATTERY_BANDGAP_MV * 1024UL) / adc);
+		}
+		ADCSRA |= (1<<ADSC);
+	}
+	return battery_mv;
+}
+
+/******************** Interrupt Service Routines *********/
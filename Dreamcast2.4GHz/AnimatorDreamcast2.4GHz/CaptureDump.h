@@ -0,0 +1,158 @@
+//-----------------------------------------------------------------------------
+//
+//  CaptureDump.h
+//
+//  Swallowtail Maple Capture Dump Firmware
+//  AVR (ATmega168PB) Raw Maple Bus Capture Output Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+#ifndef CAPTUREDUMP_H
+#define CAPTUREDUMP_H
+
+/******************** Macros *****************************/
+
+//Send the samples as runs of the same bus state instead of one byte per sample (2-3x shorter for a typical reply)
+#define CAPTURE_DUMP_EDGES
+//Send every capture, not only the ones the decoder rejected (slows polling down a lot)
+#undef CAPTURE_DUMP_ALL
+
+//Capture payload: result, sequence, flags, cycles per sample, F_CPU (100kHz), samples (little endian), then the data
+#define CAPTURE_HEADER_SIZE 7
+#define CAPTURE_FLAG_PACKED 0x01 //Raw data holds two samples per byte (high nibble first)
+#define CAPTURE_FLAG_EDGES 0x02 //Data holds runs: state in bits 6-7, length - 1 in bits 0-5
+
+#define CAPTURE_RUN_MAX 64 //Longest run one byte holds
+#define CAPTURE_RUN(state, length) ((uint8_t)(((state) << 6) | ((length) - 1)))
+#define CAPTURE_RUN_STATE(run) ((run) >> 6)
+#define CAPTURE_RUN_LENGTH(run) (((run) & 0x3F) + 1)
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <stdint.h>
+#ifdef __AVR__
+#include <avr/io.h> //Timer.h and Serial.h have to be included first
+#endif
+
+/******************* Globals *****************************/
+
+#ifdef __AVR__
+static uint8_t capture_seq; //Sequence number of the next dump, shows the dumps that were skipped
+#endif
+
+/******************** Functions **************************/
+
+//Bus state of sample i (pin 1 in bit 0, pin 5 in bit 1)
+static inline uint8_t CaptureDump_Sample(const volatile uint8_t *buf, uint16_t i, uint8_t packed){
+	if(packed){
+		return (buf[i >> 1] >> ((i & 1) ? 0 : 4)) & 0x03;
+	}
+	return buf[i] & 0x03;
+}
+
+#ifdef __AVR__
+#ifdef CAPTURE_DUMP_EDGES
+//Number of run bytes the capture turns into
+static uint16_t captureRuns(const volatile uint8_t *buf, uint16_t samples, uint8_t packed){
+	uint16_t i, runs = 1;
+	uint8_t state = CaptureDump_Sample(buf, 0, packed), length = 1;
+	for(i=1; i<samples; i++){
+		uint8_t cur = CaptureDump_Sample(buf, i, packed);
+		if(cur != state || length == CAPTURE_RUN_MAX){
+			runs++;
+			state = cur;
+			length = 0;
+		}
+		length++;
+	}
+	return runs;
+}
+#endif
+
+//Count a capture that is not sent, so the sequence numbers still show it
+void CaptureDump_Skip(){
+	capture_seq++;
+	return; //Return to call point
+}
+
+//Send the capture behind a decoder result out of the serial port (call right after decoding, before maplebuf is reused)
+//cycles is the CPU cycles per sample the capture was taken with
+void CaptureDump_Frame(const volatile uint8_t *buf, uint16_t samples, uint8_t packed, uint8_t cycles, int8_t result){
+	uint16_t i, length;
+	uint8_t flags = packed ? CAPTURE_FLAG_PACKED : 0;
+	//Nothing was captured on a timeout
+	if(result == -1){
+		return;
+	}
+#ifndef CAPTURE_DUMP_ALL
+	if(result >= 0){
+		CaptureDump_Skip();
+		return;
+	}
+#endif
+#ifdef CAPTURE_DUMP_EDGES
+	flags = CAPTURE_FLAG_EDGES;
+	length = captureRuns(buf, samples, packed);
+#else
+	length = packed ? (samples + 1) / 2 : samples;
+#endif
+	Serial_FrameBegin(SERIAL_TYPE_CAPTURE, CAPTURE_HEADER_SIZE + length);
+	Serial_FrameByte(result);
+	Serial_FrameByte(capture_seq++);
+	Serial_FrameByte(flags);
+	Serial_FrameByte(cycles);
+	Serial_FrameByte(F_CPU / 100000UL);
+	Serial_FrameByte(samples & 0xFF);
+	Serial_FrameByte(samples >> 8);
+#ifdef CAPTURE_DUMP_EDGES
+	{
+		uint8_t state = CaptureDump_Sample(buf, 0, packed), run = 1;
+		for(i=1; i<samples; i++){
+			uint8_t cur = CaptureDump_Sample(buf, i, packed);
+			if(cur != state || run == CAPTURE_RUN_MAX){
+				Serial_FrameByte(CAPTURE_RUN(state, run));
+				state = cur;
+				run = 0;
+			}
+			run++;
+		}
+		Serial_FrameByte(CAPTURE_RUN(state, run));
+	}
+#else
+	for(i=0; i<length; i++){
+		Serial_FrameByte(buf[i]);
+	}
+#endif
+	Serial_FrameEnd();
+	return; //Return to call point
+}
+#endif
+
+/******************** Interrupt Service Routines *********/
+
+#endif
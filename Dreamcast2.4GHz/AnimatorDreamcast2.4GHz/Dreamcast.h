@@ -32,12 +32,45 @@
 
 /******************** Macros *****************************/
 #define MAX_ERRORS 100 //Max allowable errors per frame before we need to reset the device
+#define MAX_TIMEOUTS 20 //Polls in a row without a reply before the device is taken as gone
+#define MAX_OVERFLOWS 3 //Replies in a row too long for the buffer before the device is reset
+#define LRC_RETRIES 2 //Immediate retries of a GET_CONDITION whose reply failed the LRC check
+#define BACKOFF_MAX 4 //Longest wait between polls to a silent device (2^4 poll periods)
+#define RECONNECT_BINS 5 //Reconnect time histogram: <10ms, <100ms, <1s, <10s, longer
+#define BANNER_FRAME_MS 66 //Time between two frames of the VMS LCD banner animation
+#define BANNER_DELAY_MS 1800 //Time between finding the VMS and showing the first logo (sending it right away does not work)
+#define BANNER_HOLD_MS 3300 //Time until the transition to the second logo starts
+#define DEVINFO_SIZE 112 //Payload of a device info reply (28 words)
+#define DEVINFO_CAPTURED ((REPLY_SIZE & ~3) - 4) //Device info bytes a cut off reply still has (whole words after the header)
+#define REPLY_SIZE 30 //Bytes of a reply kept (header, function code and condition; device info replies are cut short)
+#define DREAMCAST_PAYLOAD_SIZE 5 //Bytes of radio payload a driver packs
+#define DREAMCAST_DRIVERS 3 //Entries in the driver registry
+#define RUMBLE_SIZE 4 //Puru-Puru condition word: special, effect 1, effect 2, duration (as sent by the receiver)
+
+//Keyboard usage codes mapped to pad buttons by the keyboard driver
+#define KEY_A 0x04
+#define KEY_S 0x16
+#define KEY_X 0x1B
+#define KEY_Z 0x1D
+#define KEY_ENTER 0x28
+#define KEY_SPACE 0x2C
+#define KEY_RIGHT 0x4F
+#define KEY_LEFT 0x50
+#define KEY_DOWN 0x51
+#define KEY_UP 0x52
+
+#define DREAMCAST_POLL_HZ 120 //GET_CONDITION rate (the radio keeps up, a packet is under 1ms on the air unless it has to retry a lot)
+#define DREAMCAST_POLL_TICKS (1000UL * TIMER_TICKS_PER_MS / DREAMCAST_POLL_HZ) //Must stay under one Timer1 wrap (32.8ms)
+#define REPLY_TAIL_TICKS (2UL * TIMER_TICKS_PER_MS) //Time for a device info reply to finish after we stop listening (2ms)
+
+//A device info reply (117 bytes) never fits: the 120us capture window cuts it off (-2), or with the 320us packed
+//window REPLY_SIZE does first (-3). Either way the header and the start of the device info are in the reply buffer
+#define DEVINFO_CUT (MAPLE_RX_PACKED ? -3 : -2) //The usual result of a device info read
+#define DEVINFO_READ(v) ((v) == -2 || (v) == -3) //Device info read that got the header and the function codes
 
 #define STATE_RESET_DEVICE		0 //State machine code to trigger a reset
 #define STATE_GET_INFO			1
 #define STATE_READ_PAD			2
-#define STATE_LCD_DETECT		5
-#define STATE_BANNER_DISPLAY	6
 #define STATE_NULL				7
 
 #define DC_C 0x00
@@ -65,21 +98,29 @@
 /******************** Includes ***************************/
 
 #include <avr/io.h>
+#include <stddef.h>
+#include "MapleTiming.h" //First, an unsupported F_CPU is reported before anything else trips over it
+#include "Timer.h"
+#include "Serial.h"
+#include "CaptureDump.h"
+#include "Arena.h"
 #include "MapleBus.h"
+#include "VMU.h"
+#include "HUD.h"
 
 /******************* Globals *****************************/
 
 //Struct for holding the device info response type
-/*typedef struct DeviceInfo {
-	uint32_t function;	//Function codes supported by this peripheral (or:ed together) (big endian)
-	uint32_t function_data[3]; //Additional info for the supported function codes (big endian)
+typedef struct DeviceInfo {
+	uint32_t function;	//Function codes supported by this peripheral (or:ed together)
+	uint32_t function_data[3]; //Additional info for the supported function codes
 	uint8_t area_code; //Region Code of the peripheral
 	uint8_t connector_direction; //Physical orientation of bus connection
-	char product_name[30]; //Name of the peripheral
-	char product_license[60]; //License statement
-	uint16_t standby_power; //Standby power consumption (little endian)
-	uint16_t max_power; //Maximum power consumption (little endian)
-};*/
+	char product_name[30]; //Name of the peripheral (space padded)
+	char product_license[60]; //License statement (space padded)
+	uint16_t standby_power; //Standby power consumption (0.1mA)
+	uint16_t max_power; //Maximum power consumption (0.1mA)
+} DeviceInfo;
 /*
 Available Function Codes:
 Code	Function
@@ -106,92 +147,443 @@ typedef struct ControllerStatus {
 	uint8_t joyy2; // second analogue joystick Y (0-255)
 } ControllerStatus;
 
+//Support for one function code: how big its condition is and how it maps onto the controller status (the receiver
+//only knows the controller payload, so every device is sent the way packController puts a controller)
+typedef struct MapleDriver {
+	uint16_t func; //Function code handled
+	uint8_t cond_len; //Bytes of condition data after the function code in a GET_CONDITION reply
+	void (*decode)(const uint8_t *cond, ControllerStatus *controller); //Condition data to controller status
+} MapleDriver;
+
 static unsigned char state = STATE_RESET_DEVICE; //Holds the current state machine operation
 static uint8_t lcd_addr = 0; //Holds the byte address on a device to write to the VMS LCD screen
+static uint8_t rumble_addr = 0; //Address of the Puru-Puru pack (0 if there is none)
+static uint8_t rumble_cmd[4 + RUMBLE_SIZE] = { MAPLE_FUNC_PURUPURU & 0xFF, MAPLE_FUNC_PURUPURU >> 8, 0x00, 0x00 }; //SET_CONDITION payload: function code, then the vibration setting
+static uint8_t rumble_pending = 0; //Set when a vibration setting is waiting for a free slot
 static uint16_t cur_connected_device = MAPLE_FUNC_CONTROLLER; //Default Device is a Dreamcast Controller
-//LCD Data for Boosto Logo
-const char lcd_data_boosto[200] PROGMEM = {
-	0x00, 0x00, 0x00, 0x04,
-	0x00, 0x00, 0x00, 0x00,
-	#include "BoostoLogo.h"
+static MapleDriver cur_driver; //Driver of the connected device (copied out of the registry in flash)
+static uint8_t banner_frame = VMU_BANNER_FRAMES; //Next frame of the banner animation on the VMS LCD screen (VMU_BANNER_FRAMES when done)
+static uint32_t banner_start; //Timer_Millis when the VMS was found
+static uint8_t periph_connected = 0; //Sub-device bits from the last reply header of the controller
+static uint8_t periph_pending = 0; //Sub-devices that still have to be asked for their device info
+static uint16_t periph_func[5]; //Function codes of the sub-devices 0 to 4 (0 if nothing is plugged in)
+static uint8_t periph_turn = 0; //Set when the next slot goes to the peripherals instead of a poll
+static uint8_t reply_wait = 0; //Set while the end of a device info reply may still be on the bus
+static uint16_t reply_tick; //Timer1 when the last device info request was answered
+static uint16_t poll_tick; //Timer1 when the last GET_CONDITION was sent
+static unsigned char reply[REPLY_SIZE]; //Decoded reply, shared by every exchange instead of a copy on the stack of each (not in the arena: it is filled while the capture is read)
+
+//Counters kept by the error recovery
+typedef struct DreamcastErrors {
+	uint16_t timeouts; //No reply (-1)
+	uint16_t lrc_errors; //Reply failed the LRC or framing check (-2)
+	uint16_t overflows; //Reply longer than the buffer (-3)
+	uint16_t lrc_recovered; //LRC errors fixed by an immediate retry
+	uint16_t resets; //Devices reset after repeated overflows
+	uint16_t reconnects; //Times the controller came back after failing
+	uint16_t reconnect_hist[RECONNECT_BINS]; //How long it took to come back
+} DreamcastErrors;
+
+static DreamcastErrors dc_errors;
+static uint8_t err_count = 0; //Failed polls in a row (any class)
+static uint8_t timeout_count = 0; //Polls in a row without a reply
+static uint8_t overflow_count = 0; //Polls in a row with too much data
+static uint8_t backoff = 0; //Poll periods skipped to a silent device are 2^backoff - 1
+static uint8_t backoff_skip = 0; //Poll periods left to skip
+static uint8_t link_down = 0; //Set from the first failed poll until a good one
+static uint32_t link_down_ticks; //Timer1 ticks the link has been down
+static uint16_t link_tick; //Timer1 on the last Dreamcast_Read call
+//Pre-encoded GET_CONDITION request for the controller on port B (sent on every poll)
+const char maple_frame_get_condition[MAPLE_ENC_SIZE(1)] PROGMEM = {
+	MAPLE_ENC_FRAME1W(MAPLE_CMD_GET_CONDITION, MAPLE_ADDR_PORTB | MAPLE_ADDR_MAIN, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, MAPLE_FUNC_CONTROLLER)
 };
-//LCD Data for Swallowtail Logo
-const char lcd_data_swallowtail[200] PROGMEM = {
-	0x00, 0x00, 0x00, 0x04,
-	0x00, 0x00, 0x00, 0x00,
-	#include "SwallowtailLogo.h"
+//Pre-encoded RQ_DEV_INFO requests for the main device ([0]) and the sub-devices 0 to 4 on port B
+const char maple_frame_dev_info[6][MAPLE_ENC_SIZE(0)] PROGMEM = {
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_MAIN | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) },
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_SUB(0) | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) },
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_SUB(1) | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) },
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_SUB(2) | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) },
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_SUB(3) | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) },
+	{ MAPLE_ENC_FRAME(MAPLE_CMD_RQ_DEV_INFO, MAPLE_ADDR_SUB(4) | MAPLE_ADDR_PORTB, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB) }
 };
 
 /******************** Functions **************************/
 
-//Set the device that is currently connected (Gather report size)
-static void setConnectedDevice(uint16_t func)
+uint8_t Dreamcast_VMS_LCD_Write(uint8_t frame);
+
+//Decode a device info reply (the payload after the frame header). Only the first len bytes were captured (the function
+//codes, their data, the region, the connector direction and the start of the product name), the rest is zeroed.
+//Both the bus and the AVR are little endian without padding, so the fields line up with the reply as it is
+static void parseDeviceInfo(const uint8_t *payload, uint8_t len, DeviceInfo *info)
 {
-	cur_connected_device = func;
+	_Static_assert(sizeof(DeviceInfo) == DEVINFO_SIZE, "DeviceInfo does not match the device info reply");
+	_Static_assert(offsetof(DeviceInfo, product_name) < DEVINFO_CAPTURED, "Device info reply cut off before the product name");
 
-	switch (func)
-	{
-		case MAPLE_FUNC_CONTROLLER:
-			//A Standard Dreamcast Controller is connected
-			
-		break;
+	if (len > DEVINFO_SIZE) {
+		len = DEVINFO_SIZE;
 	}
+	memset(info, 0, sizeof(DeviceInfo));
+	memcpy(info, payload, len);
 }
 
-//Check the controller for any added peripherals (e.g. VMS or rumble pack)
-static void checkPeripherals(void)
+//Function codes of the device that sent a (cut off) device info reply. The reply is decoded in the arena, a DeviceInfo
+//is too big for the stack, so the arena has to be free (right after maple_receiveFrame)
+ARENA_FITS(sizeof(DeviceInfo), "DeviceInfo");
+static uint32_t deviceInfoFunction(const uint8_t *reply)
 {
-	int i, v;
-	unsigned char tmp[30];
+	DeviceInfo *info = (DeviceInfo *)ARENA;
+	uint32_t function;
+
+	Arena_Claim(ARENA_DEVINFO);
+	// 0-3 Header
+	// 4-115 Device info (as much of it as was captured)
+	parseDeviceInfo(reply + 4, DEVINFO_CAPTURED, info);
+	function = info->function;
+	Arena_Release(ARENA_DEVINFO);
+	return function;
+}
 
+//Standard controller (also arcade sticks and light guns, their buttons come in through the controller function)
+static void decodeController(const uint8_t *cond, ControllerStatus *controller)
+{
+	controller->joyx = cond[4]; // 4 : Joy X axis
+	controller->joyy = cond[5]; // 5 : Joy Y axis
+	controller->rtrigger = cond[2] / 2 + 0x80; // 2 : R trig
+	controller->ltrigger = cond[3] / 2 + 0x80; // 3 : L trig
+	controller->buttons = (uint16_t)((cond[1] ^ 0xff) << 8) | ((cond[0] ^ 0xff) & 0xFF); // 0 : Buttons
+}
+
+//Keyboard: arrows are the D-pad, Z/X/A/S are A/B/X/Y, Enter is Start and Space is C (X and Y are not in the radio payload)
+static void decodeKeyboard(const uint8_t *cond, ControllerStatus *controller)
+{
+	uint8_t i;
+	uint16_t buttons = 0;
+
+	//0 : Modifiers, 1 : LEDs, 2-7 : Keys held down
+	for (i=2; i<8; i++) {
+		switch (cond[i])
+		{
+			case KEY_UP: buttons |= (1<<DC_UP); break;
+			case KEY_DOWN: buttons |= (1<<DC_DOWN); break;
+			case KEY_LEFT: buttons |= (1<<DC_LEFT); break;
+			case KEY_RIGHT: buttons |= (1<<DC_RIGT); break;
+			case KEY_Z: buttons |= (1<<DC_A); break;
+			case KEY_X: buttons |= (1<<DC_B); break;
+			case KEY_A: buttons |= (1<<DC_X); break;
+			case KEY_S: buttons |= (1<<DC_Y); break;
+			case KEY_ENTER: buttons |= (1<<DC_STRT); break;
+			case KEY_SPACE: buttons |= (1<<DC_C); break;
+		}
+	}
+	controller->buttons = buttons;
+	controller->rtrigger = 0x80;
+	controller->ltrigger = 0x80;
+	controller->joyx = 0x80;
+	controller->joyy = 0x80;
+}
+
+//Mouse movement (axes centered on $200) to the joystick
+static uint8_t mouseAxis(const uint8_t *axis)
+{
+	int16_t delta = (int16_t)(axis[0] | axis[1]<<8) - 0x200;
+
+	if (delta > 127) {
+		delta = 127;
+	}
+	else if (delta < -128) {
+		delta = -128;
+	}
+	return (uint8_t)(delta + 0x80);
+}
+
+//Mouse: left/right/side buttons are A/B/Start and the movement is the joystick
+static void decodeMouse(const uint8_t *cond, ControllerStatus *controller)
+{
+	uint8_t buttons = cond[0] ^ 0xff; //0-3 : Buttons (active low)
+
+	controller->buttons = (BIT_SET(buttons, 2) ? (1<<DC_A) : 0) | (BIT_SET(buttons, 1) ? (1<<DC_B) : 0) | (BIT_SET(buttons, 3) ? (1<<DC_STRT) : 0);
+	controller->rtrigger = 0x80;
+	controller->ltrigger = 0x80;
+	controller->joyx = mouseAxis(cond + 4); //4-5 : X movement
+	controller->joyy = mouseAxis(cond + 6); //6-7 : Y movement
+}
+
+//Queue a vibration setting from the receiver, it goes out in the next slot between two polls. Returns 0 if there is no Puru-Puru pack
+uint8_t Dreamcast_Rumble(const uint8_t *setting){
+	if (!rumble_addr) {
+		return 0;
+	}
+	memcpy(rumble_cmd + 4, setting, RUMBLE_SIZE);
+	rumble_pending = 1;
+	return 1;
+}
+
+//Put a controller status into the radio payload
+static void packController(const ControllerStatus *controller, uint8_t *payload)
+{
+	payload[0] = ((uint16_t)controller->buttons >> 0) & 0xFF; //First byte of digital buttons
+	payload[1] = controller->ltrigger; //Left Analog Trigger
+	payload[2] = controller->rtrigger; //Right Analog Trigger
+	payload[3] = controller->joyx; //Left joystick for direction (X-coord)
+	payload[4] = controller->joyy; //Left joystick for direction (Y-coord)
+}
+
+//Driver registry, the first entry whose function code the device supports is used
+static const MapleDriver maple_drivers[DREAMCAST_DRIVERS] PROGMEM = {
+	{ MAPLE_FUNC_CONTROLLER, 8, decodeController },
+	{ MAPLE_FUNC_KEYBOARD, 8, decodeKeyboard },
+	{ MAPLE_FUNC_MOUSE, 20, decodeMouse }
+};
+
+//Set the device that is currently connected (picks its driver). Returns 0 if there is no driver for it
+static uint8_t setConnectedDevice(uint32_t func)
+{
+	uint8_t i;
+
+	for (i=0; i<DREAMCAST_DRIVERS; i++) {
+		memcpy_P(&cur_driver, &maple_drivers[i], sizeof(MapleDriver));
+		if (func & cur_driver.func) {
+			cur_connected_device = cur_driver.func;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+//Find the VMS LCD screen and the Puru-Puru pack among the sub-devices, the banner is played again when the LCD changes
+static void findLCD(void)
+{
+	uint8_t i, addr = 0;
+
+	rumble_addr = 0;
 	for (i=0; i<5; i++) {
-		maple_sendFrame(MAPLE_CMD_RQ_DEV_INFO,
-		MAPLE_ADDR_SUB(i) | MAPLE_ADDR_PORTB,
-		MAPLE_DC_ADDR | MAPLE_ADDR_PORTB,
-		0, 0x00);
-		v =  maple_receiveFrame(tmp, 30);
-		if (v==-2) {
-			_delay_ms(2);
-			uint16_t func = tmp[4] | tmp[5]<<8;
-
-			if (func & MAPLE_FUNC_LCD) {
-				lcd_addr = MAPLE_ADDR_SUB(i) | MAPLE_ADDR_PORTB;
-			}
+		if (!rumble_addr && (periph_func[i] & MAPLE_FUNC_PURUPURU)) {
+			rumble_addr = MAPLE_ADDR_SUB(i) | MAPLE_ADDR_PORTB;
+		}
+		if (!addr && (periph_func[i] & MAPLE_FUNC_LCD)) {
+			addr = MAPLE_ADDR_SUB(i) | MAPLE_ADDR_PORTB;
+		}
+	}
+	if (!rumble_addr) {
+		rumble_pending = 0;
+	}
+	if (addr != lcd_addr) {
+		lcd_addr = addr;
+		banner_frame = 0;
+		banner_start = Timer_Millis();
+	}
+}
+
+//Compare the sub-device bits of a reply header with what is known, forget the sub-devices that changed and queue them for a probe
+static void checkConnection(uint8_t src_addr)
+{
+	uint8_t i;
+	uint8_t connected = src_addr & 0x1F;
+	uint8_t changed = connected ^ periph_connected;
+
+	if (!changed) {
+		return;
+	}
+	for (i=0; i<5; i++) {
+		if (changed & MAPLE_ADDR_SUB(i)) {
+			periph_func[i] = 0;
 		}
 	}
+	periph_pending = (periph_pending | changed) & connected;
+	periph_connected = connected;
+	findLCD();
+}
+
+//Ask one pending sub-device for its device info (one per slot so the controller keeps being polled)
+static void probePeripheral(void)
+{
+	int i, v;
+	unsigned char *tmp = reply;
+
+	for (i=0; !(periph_pending & MAPLE_ADDR_SUB(i)); i++);
+	periph_pending &= ~MAPLE_ADDR_SUB(i);
+
+	maple_sendEncoded_P(maple_frame_dev_info[i+1], sizeof(maple_frame_dev_info[i+1]));
+	MAPLE_DUMP_EXPECT(DEVINFO_CUT); //Cut short like every device info reply, not worth a capture dump
+	v = maple_receiveFrame(tmp, REPLY_SIZE);
+	if (v != -1) {
+		//The reply is longer than what is captured, the next frame has to wait until it is over
+		reply_wait = 1;
+		reply_tick = Timer_Now();
+	}
+	if (DEVINFO_READ(v)) {
+		periph_func[i] = (uint16_t)deviceInfoFunction(tmp);
+	}
+	findLCD();
+}
+
+//Send the waiting vibration setting to the Puru-Puru pack (SET_CONDITION, Code 14)
+static void sendRumble(void)
+{
+	unsigned char *tmp = reply;
+
+	rumble_pending = 0;
+	maple_sendFrame(MAPLE_CMD_SET_CONDITION, rumble_addr, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, sizeof(rumble_cmd), rumble_cmd);
+	maple_receiveFrame(tmp, REPLY_SIZE);
+}
+
+//Write the next banner frame if it is due: hold the first logo, then play the transition one frame at a time
+static uint8_t advanceBanner(void)
+{
+	uint16_t due = banner_frame ? BANNER_HOLD_MS + banner_frame * BANNER_FRAME_MS : BANNER_DELAY_MS;
+
+	if (!lcd_addr || banner_frame >= VMU_BANNER_FRAMES || Timer_Millis() - banner_start < due) {
+		return 0;
+	}
+	Dreamcast_VMS_LCD_Write(banner_frame++);
+	if (banner_frame >= VMU_BANNER_FRAMES) {
+		HUD_Invalidate(); //The status screen takes over
+	}
+	return 1;
 }
 
 //Initialize the USI on the ATmega168/328 for Three-Wire Operation
 void Dreamcast_init(){
 	
+	//Start the timebase used to measure the Maple exchanges
+	Timer_init();
 	//Initialize the Maple Bus Connection
 	maple_init();
+#ifdef MAPLE_DUMP
+	//Serial output for the capture dumps
+	Serial_init();
+#endif
 	return; //Return to call point
 }
 
-//Write to the VMS LCD Screen (ID indicates whether to write the Swallowtail Logo or Ethan's Logo
-uint8_t Dreamcast_VMS_LCD_Write(char id){
+//Write a frame of the banner animation to the VMS LCD Screen (0 is the Swallowtail Logo, the last frame is Ethan's Logo)
+uint8_t Dreamcast_VMS_LCD_Write(uint8_t frame){
 	//Create a Maple Frame with the bulk write command (Code 12) targeted at the VMS LCD screen ($004)
-	unsigned char tmp[30];
+	unsigned char *tmp = reply;
 
 	if (lcd_addr) {
-		maple_sendFrame_P(MAPLE_CMD_BLOCK_WRITE, lcd_addr, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, 200, id ? lcd_data_boosto : lcd_data_swallowtail);
-		maple_receiveFrame(tmp, 30);
+		VMU_Show(vmu_banner, vmu_banner_index, frame, lcd_addr);
+		maple_receiveFrame(tmp, REPLY_SIZE);
 	}
 	return 0;
 }
 
+//Count a failed poll and pick the recovery for its class
+static void pollFailed(int v)
+{
+	if (!link_down) {
+		link_down = 1;
+		link_down_ticks = 0;
+	}
+	err_count++;
+	if (v == -3) {
+		//Too much data: the device is confused, reset it if it keeps happening
+		dc_errors.overflows++;
+		timeout_count = 0;
+		if (++overflow_count >= MAX_OVERFLOWS) {
+			dc_errors.resets++;
+			overflow_count = 0;
+			state = STATE_RESET_DEVICE;
+		}
+	}
+	else if (v == -2) {
+		//Bad LRC left after the retries: a noisy line, just count it
+		dc_errors.lrc_errors++;
+		timeout_count = 0;
+		overflow_count = 0;
+	}
+	else {
+		//Nothing answered: the controller may be unplugged, poll it less and less often
+		dc_errors.timeouts++;
+		overflow_count = 0;
+		if (backoff < BACKOFF_MAX) {
+			backoff++;
+		}
+		backoff_skip = (1<<backoff) - 1;
+		if (++timeout_count >= MAX_TIMEOUTS) {
+			timeout_count = 0;
+			state = STATE_GET_INFO; //We need to re-capture the device information
+		}
+	}
+	//If the amount of errors passes a threshold start over with the device information
+	if (err_count > MAX_ERRORS) {
+		err_count = 0;
+		state = STATE_GET_INFO;
+	}
+}
+
+//A good poll: clear the error state and file how long the link was down
+static void pollRecovered(void)
+{
+	uint32_t ms;
+	uint8_t bin;
+
+	err_count = 0;
+	timeout_count = 0;
+	overflow_count = 0;
+	backoff = 0;
+	backoff_skip = 0;
+	if (!link_down) {
+		return;
+	}
+	link_down = 0;
+	ms = link_down_ticks / TIMER_TICKS_PER_MS;
+	for (bin=0; bin<RECONNECT_BINS-1 && ms>=10; bin++) {
+		ms /= 10;
+	}
+	dc_errors.reconnect_hist[bin]++;
+	dc_errors.reconnects++;
+}
+
+//Read back the error counters and the reconnect time histogram
+const DreamcastErrors *Dreamcast_Errors(){
+	return &dc_errors;
+}
+
+//Put a controller status into the radio payload (every driver decodes into a controller status, so one layout fits all)
+void Dreamcast_Pack(const ControllerStatus *controller, uint8_t *payload){
+	packController(controller, payload);
+	return; //Return to call point
+}
+
+//Redraw the link status on the VMS LCD screen if it changed. Call right after a poll so the write fits before the next GET_CONDITION
+uint8_t Dreamcast_HUD_Write(){
+	unsigned char *tmp = reply;
+
+	//The banner owns the screen until it is done, and a device info reply may still be on the bus
+	if (state != STATE_READ_PAD || !lcd_addr || banner_frame < VMU_BANNER_FRAMES || reply_wait || !HUD_Dirty()) {
+		return 0;
+	}
+	HUD_Render();
+	VMU_Write(lcd_addr);
+	maple_receiveFrame(tmp, REPLY_SIZE);
+	return 1;
+}
+
 //Writes the byte into the device
 uint8_t Dreamcast_Read(ControllerStatus *controller){
 	//Dreamcast Controller is queried with the Get condition request (Code 9)
 	//The condition structure for the Controller function code ($001) will be entered into the given ControllerStatus struct
 	static uint8_t success = 0x00; //Flag to indicate if communication is successful
-	static unsigned char err_count = 0;
-	unsigned char tmp[30];
+	uint8_t tries;
+	uint16_t now = Timer_Now();
+	unsigned char *tmp = reply;
 	static unsigned char func_data[4];
-	static int lcd_detect_count = 0;
 	int v;
 	//MapleBusFrame frame;
+
+	//Time the link has been down, this is called far more often than Timer1 wraps
+	if (link_down) {
+		link_down_ticks += (uint16_t)(now - link_tick);
+	}
+	link_tick = now;
+	//Don't talk over the end of a device info reply, give the slot back instead of waiting
+	if (reply_wait) {
+		if ((uint16_t)(now - reply_tick) < REPLY_TAIL_TICKS) {
+			return 0x00;
+		}
+		reply_wait = 0;
+	}
 	switch (state)
 	{
 		case STATE_NULL:
@@ -213,102 +605,101 @@ uint8_t Dreamcast_Read(ControllerStatus *controller){
 
 		case STATE_GET_INFO:
 		{
-			maple_sendFrame(MAPLE_CMD_RQ_DEV_INFO,
-			MAPLE_ADDR_MAIN | MAPLE_ADDR_PORTB,
-			MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, 0, 0x00);
-
-			v = maple_receiveFrame(tmp, 30);
-
-			// Too much data arrives and we stop listening before the controller stop transmitting. The delay
-			// here is to wait until the bus is idle again before continuing.
-			_delay_ms(2);
-			if (v==-2) {
-				uint16_t func;
-
-				// 0-3 Header
-				// 4-7 Func
-				// ...
-				
-				func = tmp[4] | tmp[5]<<8;
-				//If the device connected is a Dreamcast Controller/Then set the connected device as such
-				if (func & MAPLE_FUNC_CONTROLLER) {
-					setConnectedDevice(MAPLE_FUNC_CONTROLLER);
-					state = STATE_LCD_DETECT;
-					lcd_detect_count = 0;
+			maple_sendEncoded_P(maple_frame_dev_info[0], sizeof(maple_frame_dev_info[0]));
+
+			//The reply never fits (see DEVINFO_CUT), the normal outcome is not worth a capture dump
+			MAPLE_DUMP_EXPECT(DEVINFO_CUT);
+			v = maple_receiveFrame(tmp, REPLY_SIZE);
+
+			// Too much data arrives and we stop listening before the controller stop transmitting. The next
+			// call waits until the bus is idle again before continuing.
+			if (v != -1) {
+				reply_wait = 1;
+				reply_tick = Timer_Now();
+			}
+			if (DEVINFO_READ(v)) {
+				//If there is a driver for the device connected then set the connected device as such
+				if (setConnectedDevice(deviceInfoFunction(tmp))) {
+					//Start the sub-devices over, they are probed in between polls
+					checkConnection(0);
+					checkConnection(tmp[1]);
+					periph_turn = 0;
+					state = STATE_READ_PAD;
 				}
 			}
 			success = 0x01;
-			err_count = 0;
 		}
 		break;
 
-		// Try for 2 seconds to find the address of the LCD.
-		//
-		// After 2 seconds of trying, if found, send the
-		// image.
-		//
-		// Sending the image right away after detection does not
-		// seem to work. This delay works around this.
-		case STATE_LCD_DETECT:
+		case STATE_READ_PAD:
 		{
-			checkPeripherals(); //Check to see if the LCD screen is attached
-			if (!lcd_addr)
-			{
-				//There is no VMS to write to
-			}
-			else {
-				if (lcd_detect_count > 220) {
-					Dreamcast_VMS_LCD_Write(0);
-					state = STATE_BANNER_DISPLAY;
-					lcd_detect_count = 0;
-					break;
+			//Every other slot goes to the peripherals (a device info probe, a vibration setting or a banner frame) if they need it
+			if (periph_turn) {
+				periph_turn = 0;
+				if (periph_pending) {
+					probePeripheral();
+					return 0x00;
+				}
+				if (rumble_pending) {
+					sendRumble();
+					return 0x00;
+				}
+				if (advanceBanner()) {
+					return 0x00;
 				}
 			}
-			
-			lcd_detect_count++;
-			if (lcd_detect_count > 400) {
-				state = STATE_READ_PAD;
+			//Keep the polls evenly spaced, the slots in between are left to the radio and the peripherals
+			if ((uint16_t)(Timer_Now() - poll_tick) < DREAMCAST_POLL_TICKS) {
+				return 0x00;
 			}
-			success = 0x01;
-		}
-		break;
-
-		case STATE_BANNER_DISPLAY:
-		{
-			lcd_detect_count++;
-			if (lcd_detect_count > 400) {
-				Dreamcast_VMS_LCD_Write(1);
-				state = STATE_READ_PAD;
+			poll_tick = Timer_Now();
+			//Back off from a device that doesn't answer
+			if (backoff_skip) {
+				backoff_skip--;
+				return 0x00;
+			}
+			//A bad LRC is a glitch on the line, ask again right away
+			for (tries=0; ; tries++) {
+				if (cur_connected_device == MAPLE_FUNC_CONTROLLER) {
+					maple_sendEncoded_P(maple_frame_get_condition, sizeof(maple_frame_get_condition));
+				}
+				else {
+					maple_sendFrame1W(MAPLE_CMD_GET_CONDITION, MAPLE_ADDR_PORTB | MAPLE_ADDR_MAIN, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, cur_connected_device);
+				}
+				v = maple_receiveFrame(tmp, REPLY_SIZE);
+				if (v != -2 || tries >= LRC_RETRIES) {
+					break;
+				}
 			}
-			success = 0x01;
-		}
-		break;
-		case STATE_READ_PAD:
-		{
-			maple_sendFrame1W(MAPLE_CMD_GET_CONDITION, MAPLE_ADDR_PORTB | MAPLE_ADDR_MAIN, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, MAPLE_FUNC_CONTROLLER);
-
-			v = maple_receiveFrame(tmp, 30);
-			//PORTD |= (1<<PD2);
 			//Register any errors involved with receiving that frame of data
 			if (v<=0) {
-				err_count++;
-				//If the amount of errors passes a threshold return an error code 
-				if (err_count > MAX_ERRORS) {
-					state = STATE_GET_INFO; //We need to re-capture the device information
-				}
+				pollFailed(v);
 				return 0x00;
 			}
-			err_count = 0;
-
-			if (v < 16){
-				return 0x00;
+			if (tries) {
+				dc_errors.lrc_recovered++;
 			}
+			pollRecovered();
+			//Sub-devices plugged in or pulled out show up in the source address of the reply
+			checkConnection(tmp[1]);
+			periph_turn = 1;
 
-			controller->joyx = tmp[12]; // 12 : Joy X axis
-			controller->joyy = tmp[13]; // 13 : Joy Y axis
-			controller->rtrigger = tmp[10] / 2 + 0x80; // 10 : R trig
-			controller->ltrigger = tmp[11] / 2 + 0x80; // 11 : L trig
-			controller->buttons = (uint16_t)((tmp[9] ^ 0xff) << 8) | ((tmp[8] ^ 0xff) & 0xFF); // 8 : Buttons
+			// 0-3 Header
+			// 4-7 Func
+			// 8- Condition
+			if (cur_connected_device == MAPLE_FUNC_CONTROLLER) {
+				//Plain controller, no call through the registry
+				if (v < 16){
+					return 0x00;
+				}
+				decodeController(tmp + 8, controller);
+			}
+			else {
+				if (v < 8 + cur_driver.cond_len){
+					return 0x00;
+				}
+				cur_driver.decode(tmp + 8, controller);
+			}
 			success = 0x01;
 		}
 		break;
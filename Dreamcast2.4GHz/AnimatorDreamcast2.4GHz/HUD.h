@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+//
+//  HUD.h
+//
+//  Swallowtail VMU HUD Firmware
+//  AVR (ATmega168PB) Link Status Display Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+#define HUD_WINDOW 64 //Packets per link quality measurement
+#define HUD_BATTERY_HYSTERESIS 20 //Battery changes smaller than this (mV) don't cause a redraw
+
+//3x5 font: 4 pixels per character, 7 per line
+#define HUD_CHAR_WIDTH 4
+#define HUD_LINE_HEIGHT 7
+#define HUD_LEFT 2
+#define HUD_TOP 2
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <string.h>
+//Needs VMU.h (included by Dreamcast.h before this file)
+
+/******************* Globals *****************************/
+
+//Link status shown on the VMS LCD screen
+typedef struct HUDStatus {
+	uint8_t channel; //nRF24L01 RF channel
+	uint8_t loss; //Packets dropped after all retries (percent)
+	uint16_t retries; //Retransmissions per 100 packets
+	uint16_t battery; //Supply voltage (mV)
+} HUDStatus;
+
+//Characters in the font, in the order of hud_font
+static const char hud_chars[] PROGMEM = "0123456789ABCHLORSTY%.V ";
+
+//One glyph per character: 5 rows of 3 pixels, top row in bits 14-12, leftmost pixel first
+static const uint16_t hud_font[] PROGMEM = {
+	0x7B6F, //'0'
+	0x2C97, //'1'
+	0x73E7, //'2'
+	0x73CF, //'3'
+	0x5BC9, //'4'
+	0x79CF, //'5'
+	0x79EF, //'6'
+	0x7252, //'7'
+	0x7BEF, //'8'
+	0x7BCF, //'9'
+	0x2BED, //'A'
+	0x6BAE, //'B'
+	0x3923, //'C'
+	0x5BED, //'H'
+	0x4927, //'L'
+	0x2B6A, //'O'
+	0x6BAD, //'R'
+	0x388E, //'S'
+	0x7492, //'T'
+	0x5A92, //'Y'
+	0x52A5, //'%'
+	0x0002, //'.'
+	0x5B6A, //'V'
+	0x0000  //' '
+};
+
+static HUDStatus hud_status; //Latest values
+static HUDStatus hud_shown; //Values currently on the screen
+static uint8_t hud_dirty = 0; //Set when hud_status differs from what is on the screen
+static uint8_t hud_packets = 0; //Packets in the current measurement window
+static uint8_t hud_lost = 0; //Packets that hit MAX_RT in the window
+static uint16_t hud_retries = 0; //Sum of ARC_CNT over the window
+
+/******************** Functions **************************/
+
+//Glyph of a character (blank if the font doesn't have it)
+static uint16_t HUD_Glyph(char c){
+	uint8_t i;
+	for(i=0; i<sizeof(hud_chars) - 1; i++){
+		if(pgm_read_byte(&hud_chars[i]) == c){
+			return pgm_read_word(&hud_font[i]);
+		}
+	}
+	return 0;
+}
+
+//Draw a character with its top left corner at (x, y)
+static void HUD_Char(uint8_t x, uint8_t y, char c){
+	uint16_t glyph = HUD_Glyph(c);
+	uint8_t row, col;
+	for(row=0; row<5; row++){
+		uint8_t bits = (glyph >> (12 - 3 * row)) & 0x07;
+		uint8_t *line = vmu_fb + (y + row) * 6;
+		for(col=0; col<3; col++){
+			if(bits & (0x04 >> col)){
+				line[(x + col) >> 3] |= 0x80 >> ((x + col) & 0x07);
+			}
+		}
+	}
+}
+
+//Draw a string on a text line
+static void HUD_Text(uint8_t line, const char *text){
+	uint8_t x = HUD_LEFT;
+	while(*text){
+		HUD_Char(x, HUD_TOP + line * HUD_LINE_HEIGHT, *text++);
+		x += HUD_CHAR_WIDTH;
+	}
+}
+
+//Append a decimal number to a string, returns the new end
+static char *HUD_Number(char *p, uint16_t value){
+	char digits[5];
+	uint8_t n = 0;
+	do{
+		digits[n++] = '0' + value % 10;
+		value /= 10;
+	} while(value);
+	while(n){
+		*p++ = digits[--n];
+	}
+	*p = '\0';
+	return p;
+}
+
+//Count one transmitted packet: retries it took and whether it was lost. Returns 1 when a measurement window is complete
+uint8_t HUD_Packet(uint8_t arc_cnt, uint8_t lost){
+	hud_retries += arc_cnt;
+	if(lost){
+		hud_lost++;
+	}
+	return ++hud_packets >= HUD_WINDOW;
+}
+
+//Close the measurement window and update the values to show
+void HUD_Update(uint8_t channel, uint16_t battery){
+	int16_t delta = (int16_t)(battery - hud_shown.battery);
+	hud_status.channel = channel;
+	hud_status.loss = (uint8_t)((hud_lost * 100U) / hud_packets);
+	hud_status.retries = (uint16_t)((hud_retries * 100UL) / hud_packets);
+	hud_status.battery = battery;
+	hud_packets = 0;
+	hud_lost = 0;
+	hud_retries = 0;
+	//Only redraw on a change (the battery reading is noisy, so it needs to move a little)
+	if(hud_status.channel != hud_shown.channel || hud_status.loss != hud_shown.loss ||
+	   hud_status.retries != hud_shown.retries || delta > HUD_BATTERY_HYSTERESIS || delta < -HUD_BATTERY_HYSTERESIS){
+		hud_dirty = 1;
+	}
+	return; //Return to call point
+}
+
+//Force a redraw (something else was shown on the screen)
+void HUD_Invalidate(){
+	hud_dirty = 1;
+	return; //Return to call point
+}
+
+//Returns 1 if the screen is out of date
+uint8_t HUD_Dirty(){
+	return hud_dirty;
+}
+
+//Draw the latest values into the VMU frame buffer
+void HUD_Render(){
+	char text[12];
+	char *p;
+
+	Arena_Claim(ARENA_VMU);
+	memset(vmu_fb, 0, VMU_FB_SIZE);
+
+	strcpy(text, "CH ");
+	HUD_Number(text + 3, hud_status.channel);
+	HUD_Text(0, text);
+
+	strcpy(text, "LOSS ");
+	p = HUD_Number(text + 5, hud_status.loss);
+	strcpy(p, "%");
+	HUD_Text(1, text);
+
+	strcpy(text, "RTRY ");
+	p = HUD_Number(text + 5, hud_status.retries > 999 ? 999 : hud_status.retries);
+	strcpy(p, "%");
+	HUD_Text(2, text);
+
+	strcpy(text, "BATT ");
+	p = HUD_Number(text + 5, hud_status.battery / 1000);
+	*p++ = '.';
+	*p++ = '0' + (hud_status.battery / 100) % 10;
+	*p++ = '0' + (hud_status.battery / 10) % 10;
+	strcpy(p, "V");
+	HUD_Text(3, text);
+
+	hud_shown = hud_status;
+	hud_dirty = 0;
+	return; //Return to call point
+}
+
+/******************** Interrupt Service Routines *********/
@@ -20,6 +20,8 @@
 #include <avr/io.h>
 #include <avr/pgmspace.h>
 #include <util/delay.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
 #include <string.h>
 
 #define MAPLE_CMD_RQ_DEV_INFO		1
@@ -28,6 +30,7 @@
 #define MAPLE_CMD_SHUTDOWN_DEV		4
 #define MAPLE_CMD_GET_CONDITION		9
 #define MAPLE_CMD_BLOCK_WRITE		12
+#define MAPLE_CMD_SET_CONDITION		14
 
 #define MAPLE_FUNC_CONTROLLER	0x001
 #define MAPLE_FUNC_MEMCARD		0x002
@@ -60,11 +63,78 @@ int maple_receiveFrame(uint8_t *data, unsigned int maxlen);
 void maple_sendRaw(uint8_t *data, unsigned char len);
 
 void maple_sendFrame_P(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data_len, PGM_P data);
+void maple_sendEncoded_P(PGM_P phases, unsigned char len);
+void maple_sendFrameWords(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data_len, const uint8_t *data);
 
 #undef NOLRC
 #undef TRACE_RX_START_END
 #undef TRACE_DECODED
-#define TRACE_PIN1_BITS
+#undef TRACE_PIN1_BITS		// toggles PB4 on every sample (branch decoder only, slows decoding down)
+#undef MAPLE_DECODE_BRANCH	// use the branch based decoder instead of the lookup table
+#undef MAPLE_CAPTURE_PACKED	// store two samples per byte, 4 cycles apart (320us instead of 120us in the same buffer)
+#undef MAPLE_PROFILE		// time spent between the end of capture and the reply being ready (needs Timer.h)
+#undef MAPLE_DUMP			// send rejected captures out of PC3 for Tools/maple_dump (needs Serial.h and CaptureDump.h)
+
+#ifdef MAPLE_PROFILE
+struct maple_profile {
+	uint16_t decode_ticks;		// last end-of-capture to data-ready time (Timer1 ticks)
+	uint16_t decode_ticks_max;	// worst case seen
+	uint16_t encode_ticks;		// last send call to first bit on the bus time (Timer1 ticks)
+	uint16_t encode_ticks_max;	// worst case seen
+	uint16_t tx_start;			// Timer1 when the current send call started
+	uint8_t tx_timing;			// set while a send call is being timed
+};
+static struct maple_profile maple_profile;
+
+// Only the outermost send call starts the measurement
+#define MAPLE_PROFILE_TX_START()	do { if (!maple_profile.tx_timing) { maple_profile.tx_timing = 1; maple_profile.tx_start = Timer_Now(); } } while(0)
+#define MAPLE_PROFILE_TX_FIRST_BIT()	do { \
+		maple_profile.encode_ticks = Timer_Now() - maple_profile.tx_start; \
+		if (maple_profile.encode_ticks > maple_profile.encode_ticks_max) \
+			maple_profile.encode_ticks_max = maple_profile.encode_ticks; \
+		maple_profile.tx_timing = 0; \
+	} while(0)
+#else
+#define MAPLE_PROFILE_TX_START()
+#define MAPLE_PROFILE_TX_FIRST_BIT()
+#endif
+
+#ifdef MAPLE_DUMP
+static int maple_dump_expect = -1;	// result the caller expects from the next receive, it isn't dumped (timeouts never are)
+
+// Call before maple_receiveFrame when a result is normal there (device info replies always come back cut short, -2)
+#define MAPLE_DUMP_EXPECT(res)	do { maple_dump_expect = (res); } while(0)
+#else
+#define MAPLE_DUMP_EXPECT(res)
+#endif
+
+/*
+ * Frames encoded at compile time, ready for maple_sendEncoded_P. Each bit
+ * becomes the PORTD value of its phase: phase 1 (even bits) drives pin 1
+ * with the data on pin 5, phase 2 the other way around. This is what
+ * maple_transmit works out on the fly from the bytes of other frames.
+ *
+ * Frames are in bus order: length, source, destination, command, then the
+ * payload and the LRC of everything before it.
+ */
+#define MAPLE_ENC_PH1(v)	(0x01 | ((v) ? 0x02 : 0))
+#define MAPLE_ENC_PH2(v)	(0x02 | ((v) ? 0x01 : 0))
+#define MAPLE_ENC_BYTE(b) \
+	MAPLE_ENC_PH1((b) & 0x80), MAPLE_ENC_PH2((b) & 0x40), MAPLE_ENC_PH1((b) & 0x20), MAPLE_ENC_PH2((b) & 0x10), \
+	MAPLE_ENC_PH1((b) & 0x08), MAPLE_ENC_PH2((b) & 0x04), MAPLE_ENC_PH1((b) & 0x02), MAPLE_ENC_PH2((b) & 0x01)
+#define MAPLE_ENC_SIZE(words)	(((words) * 4 + 5) * 8)
+
+// Frame without payload
+#define MAPLE_ENC_FRAME(cmd, dst_addr, src_addr) \
+	MAPLE_ENC_BYTE(0), MAPLE_ENC_BYTE((src_addr) & 0xff), MAPLE_ENC_BYTE((dst_addr) & 0xff), MAPLE_ENC_BYTE((cmd) & 0xff), \
+	MAPLE_ENC_BYTE((0 ^ (src_addr) ^ (dst_addr) ^ (cmd)) & 0xff)
+
+// Frame with one word of payload, sent least significant byte first like maple_sendFrame1W
+#define MAPLE_ENC_FRAME1W(cmd, dst_addr, src_addr, data) \
+	MAPLE_ENC_BYTE(1), MAPLE_ENC_BYTE((src_addr) & 0xff), MAPLE_ENC_BYTE((dst_addr) & 0xff), MAPLE_ENC_BYTE((cmd) & 0xff), \
+	MAPLE_ENC_BYTE((data) & 0xff), MAPLE_ENC_BYTE(((uint32_t)(data) >> 8) & 0xff), \
+	MAPLE_ENC_BYTE(((uint32_t)(data) >> 16) & 0xff), MAPLE_ENC_BYTE(((uint32_t)(data) >> 24) & 0xff), \
+	MAPLE_ENC_BYTE((1 ^ (src_addr) ^ (dst_addr) ^ (cmd) ^ (uint32_t)(data) ^ ((uint32_t)(data) >> 8) ^ ((uint32_t)(data) >> 16) ^ ((uint32_t)(data) >> 24)) & 0xff)
 
 //
 //
@@ -81,167 +151,71 @@ void maple_init(void)
 #define inputMode() do { PORTD |= 0x03; DDRD &= ~0x03; } while(0)
 #define nop() asm volatile("nop\n");
 
-#define MAPLE_BUF_SIZE	641
-volatile unsigned char maplebuf[MAPLE_BUF_SIZE];
-static unsigned char buf_used;
-static unsigned char buf_phase;
-
-#define PIN_1	0x01
-#define PIN_5	0x02
-static void buf_reset(void)
-{
-	buf_used = 0;
-	buf_phase = 0;
-}
-
-static void buf_addBit(char value)
-{
-	// The values in maplebuf will be written
-	// directly to PORTD	. Unused bits will be low.
-	if (buf_phase & 0x01) {
-		maplebuf[buf_used] = PIN_5;
-		if (value) {
-			maplebuf[buf_used] |= PIN_1; // prepare data
-		}
-		buf_used++;
-	}
-	else {
-		maplebuf[buf_used] = PIN_1;
-		if (value) {
-			maplebuf[buf_used] |= PIN_5; // prepare data
-		}
-		buf_used++;
-	}
-	buf_phase ^= 1;
-}
-
-static int maplebus_decode(unsigned char *data, unsigned int maxlen)
-{
-	unsigned char dst_b;
-	unsigned int dst_pos;
-	unsigned char last;
-	unsigned char last_fell;
-	int i;
+// Sender and sampler timing for F_CPU, held to the bus limits (Tools/maple_timing_check shows the details)
+#include "MapleTiming.h"
 
-#ifdef TRACE_DECODED
-	PORTB |= 0x10;
-	PORTB &= ~0x10;
-	PORTB |= 0x10;
-	PORTB &= ~0x10;
-	PORTB |= 0x10;
-	PORTB &= ~0x10;
+// Number of samples taken by the receive code, written by generate_rxcode
+// next to the .asm it included. Pin 1 and pin 5 are bits 0 and 1 of each sample.
+#ifdef MAPLE_CAPTURE_PACKED
+#include "rxcode_packed.h"
+#else
+#include "rxcode.h"
 #endif
-
-	// Look for the initial phase 1 (Pin 1 high, Pin 5 low). This
-	// is to skip what we got of the sync/start of frame sequence.
-	// 
-	for (i=0; i<MAPLE_BUF_SIZE; i++) {
-		if ((maplebuf[i]&0x03) == 0x01)
-			break;
-	}
-	if (i==MAPLE_BUF_SIZE) {
-		return -1; // timeout
-	}
-
-	dst_pos = 0;
-	data[0] = 0;
-	dst_b = 0x80;
-	last = maplebuf[i] & 0x03;
-	last_fell = 0;
-	for (; i<MAPLE_BUF_SIZE; i++) {
-		unsigned char fell;
-		unsigned char cur = maplebuf[i] & 0x3;
-
-#ifdef TRACE_PIN1_BITS
-		if (cur & 1) {
-			PORTB |= 0x10;
-		} else {
-			PORTB &= ~0x10;
-		}
+#if MAPLE_RX_F_CPU != F_CPU
+#error "The Maple receive code was generated for another F_CPU, re-run Tools/generate_rxcode"
 #endif
 
-		if (cur == last) {
-			continue; // no change
-		}
+_Static_assert(MAPLE_CYCLES_NS(MAPLE_RX_CYCLES) <= MAPLE_SPEC_SAMPLE_MAX_NS, "The sampler is too slow for Maple replies at this F_CPU");
+_Static_assert(MAPLE_CYCLES_NS(MAPLE_TX_PHASE_CYCLES) >= MAPLE_SPEC_PHASE_MIN_NS, "Maple data phases are too short at this F_CPU");
+_Static_assert(MAPLE_CYCLES_NS(MAPLE_TX_PHASE_CYCLES + MAPLE_TX_GAP_MAX_CYCLES) <= MAPLE_SPEC_PHASE_MAX_NS, "Maple data phases are too long at this F_CPU");
+_Static_assert(MAPLE_CYCLES_NS(MAPLE_DLY_SYNC_CYCLES + 2) >= MAPLE_SPEC_SYNC_PULSE_NS, "Maple sync pulses are too short at this F_CPU");
 
-		fell = last & (cur ^ last);
-
-		if (!fell) {
-			// pin(s) changed, but none fell.
-			last = cur;
-			continue;
-		}
+#define MAPLE_BUF_SIZE	MAPLE_RX_BYTES
+volatile unsigned char maplebuf[MAPLE_BUF_SIZE];
 
-		if (fell == last_fell) {
-			// two identical consecutive phases marks the end of the packet.
-#ifdef TRACE_DECODED
-				PORTB |= 0x10;
-				PORTB &= ~0x10;
-				PORTB |= 0x10;
-				PORTB &= ~0x10;
-				PORTB |= 0x10;
-				PORTB &= ~0x10;
-#endif
-			break;
-		}
-
-		// when any of the two pins fall, the
-		// other pin is the data.
-		if (fell) {
-			if (fell == 0x03) {
-				// two pins at the same time!
-				PORTB |= 0x10;
-				PORTB &= ~0x10;
-			}
-
-			if (cur) {
-				data[dst_pos] |= dst_b;
+// Debug traces on PB4 while decoding
 #ifdef TRACE_DECODED
-				PORTB |= 0x10;
+#define MAPLE_TRACE_MARK()	do { PORTB |= 0x10; PORTB &= ~0x10; PORTB |= 0x10; PORTB &= ~0x10; PORTB |= 0x10; PORTB &= ~0x10; } while(0)
+#define MAPLE_TRACE_BIT(v)	do { if (v) PORTB |= 0x10; else PORTB &= ~0x10; } while(0)
 #endif
-			}
-			else {
-#ifdef TRACE_DECODED
-				PORTB &= ~0x10;
+#ifdef TRACE_PIN1_BITS
+#define MAPLE_TRACE_SAMPLE(v)	do { if (v) PORTB |= 0x10; else PORTB &= ~0x10; } while(0)
 #endif
-			}
-		}		
-		
-		dst_b >>= 1;
-		if (!dst_b) {
-			dst_b = 0x80;
-			dst_pos++;
-			if (dst_pos >= maxlen) {
-#ifdef TRACE_DECODED
-				PORTB &= ~0x10;
+#define MAPLE_TRACE_GLITCH()	do { PORTB |= 0x10; PORTB &= ~0x10; } while(0)
+#include "MapleDecode.h"
+static int maplebus_decode(unsigned char *data, unsigned int maxlen)
+{
+#ifdef MAPLE_DECODE_BRANCH
+	return maple_decode_branch(maplebuf, MAPLE_RX_SAMPLES, data, maxlen);
+#else
+	return maple_decode_lut(maplebuf, MAPLE_RX_SAMPLES, data, maxlen);
 #endif
-				return -3;
-			}
-			data[dst_pos] = 0;
-		}
+}
 
-		last_fell = fell;
-		last = cur;
-	}
+// Receive state, set by the capture and timeout interrupts
+#define MAPLE_RX_ARMED		0
+#define MAPLE_RX_DONE		1
+#define MAPLE_RX_TIMEOUT	2
+volatile unsigned char maple_rx_state;
 
-#ifdef TRACE_DECODED
-	PORTB &= ~0x10;
-#endif
+// A reply has to start within this time (the old busy-wait gave up after about 1.8ms)
+#define MAPLE_RX_TIMEOUT_US		1800
+#define MAPLE_RX_TIMEOUT_TICKS	TIMER_US_TICKS(MAPLE_RX_TIMEOUT_US)
 
-	return dst_pos;
-}
+// Cycles from the first edge to the first sample when the CPU was asleep:
+// 4 wake-up + 4 interrupt response + 3 vector jmp + 11 saving registers + 2 loading Z
+#define MAPLE_RX_LATENCY_CYCLES	24
 
 /**
- * \param data Destination buffer to store reply (payload + crc + eot)
- * \param maxlen The length of the destination buffer
- * \return -1 on timeout, -2 lrc/frame error, -3 too much data. Otherwise the number of bytes received
+ * Capture, started by the first edge of the reply on pin 1 or pin 5.
+ *
+ * maple_receiveFrame sleeps while waiting, so the interrupt always hits
+ * the same instruction and the sampler starts MAPLE_RX_LATENCY_CYCLES
+ * after the edge. That is well inside the start of frame sync, which the
+ * decoder skips anyway.
  */
-int maple_receiveFrame(unsigned char *data, unsigned int maxlen)
+ISR(PCINT2_vect, ISR_NAKED)
 {
-	unsigned char lrc;
-	unsigned char timeout;
-	int res, i;
-
 	//
 	//  __       _   _   _
 	//    |_____| |_| |_| |_
@@ -251,38 +225,15 @@ int maple_receiveFrame(unsigned char *data, unsigned int maxlen)
 	//     ^   ^  ^  ^^  ^^
 	//
 
-	asm volatile( 
+	asm volatile(
+			"	push r16		\n" // 2
+			"	in r16, __SREG__	\n" // 1
+			"	push r16		\n" // 2
+			"	push r17		\n" // 2
 			"	push r30		\n" // 2
-			"	push r31		\n"	// 2
-			"	clr %0			\n" // 1 (result=0, no timeout)
-			
-			"	ldi r30, lo8(maplebuf)	\n"
-			"	ldi r31, hi8(maplebuf)	\n"
-//			"	sbi 0x5, 4		\n" // PB4
-//			"	cbi 0x5, 4		\n"
-
-			// Loop until a change is detected.	
-			"	ldi r19, 20		\n"
-			"wait_start_outer:	\n"
-			"	dec r19			\n"
-			"	breq timeout	\n"
-			"	ldi r18, 255	\n"
-			"	in r17, %1		\n"
-			"wait_start_inner:		\n"
-			"	dec r18			\n"
-			"	breq wait_start_outer	\n"
-			"	in r16, %1		\n"
-			"	cp r16, r17		\n"
-			"	breq wait_start_inner	\n"
-			"	rjmp start_rx	\n"
-
-"timeout:\n"
-			"	inc %0			\n" // 1 for timeout
-			"	sbi 0xB, 4		\n" // PD4
-			"	cbi 0xB, 4		\n"
-			"	jmp done		\n"
-
-"start_rx:			\n"
+			"	push r31		\n" // 2
+			"	ldi r30, lo8(maplebuf)	\n" // 1
+			"	ldi r31, hi8(maplebuf)	\n" // 1
 #ifdef TRACE_RX_START_END
 			"	sbi 0xB, 4		\n" // PD4
 			"	cbi 0xB, 4		\n"
@@ -290,323 +241,358 @@ int maple_receiveFrame(unsigned char *data, unsigned int maxlen)
 
 			// We will loose the first bit(s), but
 			// it's only the start of frame.
-			#include "rxcode.asm"			
+#ifdef MAPLE_CAPTURE_PACKED
+			#include "rxcode_packed.asm"
+#else
+			#include "rxcode.asm"
+#endif
 
-"done:\n"
 #ifdef TRACE_RX_START_END
 			"	sbi 0xB, 4		\n" // PD4
 			"	cbi 0xB, 4		\n"
 #endif
-			"	pop r31			\n" // 2
-			"	pop r30			\n" // 2
-		: "=r"(timeout)
-		: "I" (_SFR_IO_ADDR(PIND))
-		: "r16","r17","r18","r19") ;
-
-	if (timeout){
-		return -1;
-	}
-	res = maplebus_decode(data, maxlen);
-	if (res<=0)
-		return res;
+			// Disarm: no more pin change, no timeout
+			"	lds r16, %0		\n"
+			"	andi r16, %3	\n"
+			"	sts %0, r16		\n"
+			"	lds r16, %2		\n"
+			"	andi r16, %4	\n"
+			"	sts %2, r16		\n"
+			"	ldi r16, %5		\n"
+			"	sts maple_rx_state, r16	\n"
+
+			"	pop r31			\n"
+			"	pop r30			\n"
+			"	pop r17			\n"
+			"	pop r16			\n"
+			"	out __SREG__, r16	\n"
+			"	pop r16			\n"
+			"	reti			\n"
+		:
+		: "n" (_SFR_MEM_ADDR(PCICR)), "I" (_SFR_IO_ADDR(PIND)), "n" (_SFR_MEM_ADDR(TIMSK1)),
+		  "M" ((uint8_t)~(1<<PCIE2)), "M" ((uint8_t)~(1<<OCIE1A)), "M" (MAPLE_RX_DONE));
+}
 
-	// A packet contains n groups of 4 bytes, plus 1 byte crc.
-	if (((res-1) & 0x3) != 0) {
-		return -2; // frame error
-	}
+// Nothing answered in time
+ISR(TIMER1_COMPA_vect)
+{
+	PCICR &= ~(1<<PCIE2);
+	TIMSK1 &= ~(1<<OCIE1A);
+	maple_rx_state = MAPLE_RX_TIMEOUT;
+	PORTD |= (1<<PD4);
+	PORTD &= ~(1<<PD4);
+}
 
-#ifndef NOLRC
-	for (lrc=0, i=0; i<res; i++) {
-		lrc ^= data[i];
-	}
-	if (lrc)
-		return -2; // LRC error
+/**
+ * \param data Destination buffer to store reply (payload + crc + eot)
+ * \param maxlen The length of the destination buffer
+ * \return -1 on timeout, -2 lrc/frame error, -3 too much data. Otherwise the number of bytes received
+ */
+int maple_receiveFrame(unsigned char *data, unsigned int maxlen)
+{
+	unsigned char sreg = SREG;
+	int res;
+#ifdef MAPLE_PROFILE
+	uint16_t start;
 #endif
+#ifdef MAPLE_DUMP
+	int expect = maple_dump_expect;
 
-	/* Reverse each group of 4 bytes */
-	for (i=0; i<(res-1); i+=4) {
-		unsigned char tmp;
+	maple_dump_expect = -1;
+#endif
 
-		tmp = data[i+3];
-		data[i+3] = data[i];
-		data[i] = tmp;
+	// The capture goes into the arena
+	Arena_Claim(ARENA_MAPLE_RX);
+
+	// Timeout on the free running Timer1
+	maple_rx_state = MAPLE_RX_ARMED;
+	OCR1A = TCNT1 + MAPLE_RX_TIMEOUT_TICKS;
+	TIFR1 = (1<<OCF1A);
+	TIMSK1 |= (1<<OCIE1A);
+
+	// Any change on pin 1 or pin 5 starts the capture
+	PCMSK2 = (1<<PCINT16) | (1<<PCINT17);
+	PCIFR = (1<<PCIF2);
+	PCICR |= (1<<PCIE2);
+
+	// Sleep until the reply starts or the time is up. sei and sleep
+	// go back to back, so an edge can't slip in between the check and
+	// the sleep.
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	cli();
+	while (maple_rx_state == MAPLE_RX_ARMED) {
+		sleep_enable();
+		sei();
+		sleep_cpu();
+		sleep_disable();
+		cli();
+	}
+	SREG = sreg;
 
-		tmp = data[i+2];
-		data[i+2] = data[i+1];
-		data[i+1] = tmp;
+	if (maple_rx_state == MAPLE_RX_TIMEOUT){
+		Arena_Release(ARENA_MAPLE_RX);
+		return -1;
 	}
+#ifdef MAPLE_PROFILE
+	start = Timer_Now();
+#endif
+	res = maplebus_decode(data, maxlen);
+#ifdef MAPLE_PROFILE
+	maple_profile.decode_ticks = Timer_Now() - start;
+	if (maple_profile.decode_ticks > maple_profile.decode_ticks_max)
+		maple_profile.decode_ticks_max = maple_profile.decode_ticks;
+#endif
+#ifdef MAPLE_DUMP
+	if (res == expect)
+		CaptureDump_Skip();
+	else
+		CaptureDump_Frame(maplebuf, MAPLE_RX_SAMPLES, MAPLE_RX_PACKED, MAPLE_RX_CYCLES, res);
+#endif
+	Arena_Release(ARENA_MAPLE_RX);
 
-	return res-1; // remove lrc
+	return res;
 }
 
-static void maple_sendByte(uint8_t data)
-{{{
-	// Phase 1 initial state (pin 1 high, pin 5 low);
-	PORTD = 0x01;
-	_delay_us(1);
-	if (data & 0x80)
-		PORTD |= 0x02;
-	nop();
-	PORTD &= ~0x01;
-	_delay_us(1);
-	
-	// Phase 2 initial state (pin 1 low, pin 5 high;
-	PORTD = 0x02;
-	_delay_us(1);
-	if (data & 0x40)
-		PORTD |= 0x01;
-	nop();
-	PORTD &= ~0x02;
-	_delay_us(1);
-
-	// Phase 1 initial state (pin 1 high, pin 5 low);
-	PORTD = 0x01;
-	_delay_us(1);
-	if (data & 0x20)
-		PORTD |= 0x02;
-	nop();
-	PORTD &= ~0x01;
-	_delay_us(1);
-	
-	// Phase 2 initial state (pin 1 low, pin 5 high;
-	PORTD = 0x02;
-	_delay_us(1);
-	if (data & 0x10)
-		PORTD |= 0x01;
-	nop();
-	PORTD &= ~0x02;
-	_delay_us(1);
-
-	// Phase 1 initial state (pin 1 high, pin 5 low);
-	PORTD = 0x01;
-	_delay_us(1);
-	if (data & 0x08)
-		PORTD |= 0x02;
-	nop();
-	PORTD &= ~0x01;
-	_delay_us(1);
-	
-	// Phase 2 initial state (pin 1 low, pin 5 high;
-	PORTD = 0x02;
-	_delay_us(1);
-	if (data & 0x04)
-		PORTD |= 0x01;
-	nop();
-	PORTD &= ~0x02;
-	_delay_us(1);
-
-	// Phase 1 initial state (pin 1 high, pin 5 low);
-	PORTD = 0x01;
-	_delay_us(1);
-	if (data & 0x02)
-		PORTD |= 0x02;
-	nop();
-	PORTD &= ~0x01;
-	_delay_us(1);
-	
-	// Phase 2 initial state (pin 1 low, pin 5 high;
-	PORTD = 0x02;
-	_delay_us(1);
-	if (data & 0x01)
-		PORTD |= 0x01;
-	nop();
-	PORTD &= ~0x02;
-	_delay_us(1);
-}}}
-
-/* Slower C implementation for sending data from program memory. */
-void maple_sendRaw_P(unsigned char header_data[4], PGM_P data, unsigned char len)
-{
-	int i;
-	uint8_t tmp;
-	uint8_t lrc = 0;
+/* 
+ * Phase sender for frames encoded ahead of time (one PORTD value per
+ * bit, see MAPLE_ENC_FRAME). load is lpm for frames in flash: 3 cycles,
+ * one more per phase than ld, which the devices don't mind.
+ */
+#define MAPLE_TX_ASM(load) \
+		"push r31\n" \
+		"push r30\n" \
+\
+		"mov r19, %1	\n" /* Length in phase pairs */ \
+		"ldi r20, 0x01	\n" /* phase 1 pin 1 high, pin 5 low */ \
+		"ldi r21, 0x02	\n" /* phase 2 pin 1 low, pin 2 high */ \
+\
+		load \
+\
+		MAPLE_TX_SYNC \
+\
+		/* Pin 5 is low, Pin 1 is high. Ready for 1st phase */ \
+		/* Note: phase timing per F_CPU is in MapleTiming.h */ \
+"1:\n" \
+\
+		"out %0, r20	\n" /* 1  initial phase 1 state */ \
+		"out %0, r16	\n" /* 1  data */ \
+		"cbi %0, 0		\n" /* 1  falling edge on pin 1 */ \
+		load /* 3  load phase 2 data */ \
+\
+		"out %0, r21	\n" /* 1  initial phase 2 state */ \
+		"out %0, r16	\n" /* 1  data */ \
+		"cbi %0, 1		\n" /* 1  falling edge on pin 5 */ \
+		load /* 3 */ \
+		"dec r19		\n" /* 1  Decrement counter for brne below */ \
+		"brne 1b		\n" /* 2 */ \
+\
+		MAPLE_TX_EOF \
+\
+		"pop r30		\n" \
+		"pop r31		\n"
 
+/* 
+ * Send len bytes from SRAM (LRC included). Phases are worked out from
+ * the bytes as they go out, so nothing has to be expanded in maplebuf
+ * first.
+ */
+static void maple_transmit(const unsigned char *data, unsigned char len)
+{
+	// Output
 	transmitMode();
+	MAPLE_PROFILE_TX_FIRST_BIT();
 
-	// Initially both lines are high
-	PORTD = 0x03;
-	// Pin 1 falls
-	PORTD = 0x02;
-	_delay_us(1);
-	
-	// Pin 5 falls
-	PORTD = 0x00;
-	_delay_us(1);
-
-	// 3 pulses on pin 5
-	PORTD = 0x02;
-	_delay_us(1);
-	PORTD = 0x00;
-	_delay_us(1);
-	PORTD = 0x02;
-	_delay_us(1);
-	PORTD = 0x00;
-	_delay_us(1);
-	PORTD = 0x02;
-	_delay_us(1);
-	PORTD = 0x00;
-	_delay_us(1);
-
-	PORTD = 0x02;
-	_delay_us(1);
-
-	PORTD = 0x03;
-	_delay_us(1);
-	
-	// Phase 1 initial state (pin 1 high, pin 5 low);
-	PORTD = 0x01;
-
-	for (i=0; i<4; i++) {
-		maple_sendByte(header_data[i]);
-		lrc ^= header_data[i];
-	}
+	asm volatile(
+		"push r31\n"
+		"push r30\n"
 
-	for (i=0; i<len; i++) {
-		// Swap byte order in each word
-		tmp = pgm_read_byte(data + (i&0xfc) + (3-(i&0x03)));
-		maple_sendByte(tmp);
-		lrc ^= tmp;
-		if (i && (i%8==0)) {
-			_delay_us(30);
-		}
-	}
-	
-	maple_sendByte(lrc);
+		"mov r19, %1	\n" // Length in bytes
+		"ldi r20, 0x01	\n" // phase 1 pin 1 high, pin 5 low
+		"ldi r21, 0x02	\n" // phase 2 pin 1 low, pin 2 high
 
-	// End of frame initial state (Pin 1 high, pin 5 low)
-	PORTD = 0x01;
-	_delay_us(1);
+		"ld r16, z+		\n"
+		MAPLE_TX_PH1(7)
 
-	// pulse on pin5
-	PORTD = 0x03;
-	_delay_us(1);
-	PORTD = 0x01;
-	_delay_us(1);
+		MAPLE_TX_SYNC
 
-	// pin 1 falls
-	PORTD = 0x00;
-	_delay_us(1);
+		// Pin 5 is low, Pin 1 is high. Ready for 1st phase
+		// Note: phase timing per F_CPU is in MapleTiming.h
+"1:\n"
+		MAPLE_TX_BYTE
+		"ld r16, z+		\n" // 2  next byte
+		MAPLE_TX_PH1(7)			// 3
+		"dec r19		\n" // 1  Decrement counter for brne below
+		"brne 1b		\n" // 2
 
-	// pin 1 pulse
-	PORTD = 0x01;
-	_delay_us(1);
-	PORTD = 0x00;
-	_delay_us(1);
+		MAPLE_TX_EOF
 
-	// pin 1 rise
-	PORTD = 0x01;
-	_delay_us(1);
+		"pop r30		\n"
+		"pop r31		\n"
 
-	// pin 5 rise
-	PORTD = 0x03;
+		:
+		: "I" (_SFR_IO_ADDR(PORTD)), "r"(len), "z"(data)
+		: "r1","r16","r17","r18","r19","r20","r21"
+	);
 
+	// back to input to receive the answer
 	inputMode();
 }
 
-void maple_sendRaw(unsigned char *data, unsigned char len)
+/* Send phases encoded in flash (see MAPLE_ENC_FRAME). */
+static void maple_transmit_P(PGM_P phases, unsigned char pairs)
 {
-	int i;
-	unsigned char b;
-
-	buf_reset();
-	for (i=0; i<len; i++) {
-		for (b=0x80; b; b>>=1)
-		{
-			buf_addBit(data[i] & b);
-		}
-	}
-
-	// Output
 	transmitMode();
-
-	// DC controller pin 1 and pin 5
-#define SET_1		"	sbi %0, 0\n"
-#define CLR_1		"	cbi %0, 0\n"
-#define SET_5		"	sbi %0, 1\n"
-#define CLR_5		"	cbi %0, 1\n"
-#define DLY_8		"	nop\nnop\nnop\nnop\nnop\nnop\nnop\nnop\n"
-#define DLY_5		"	nop\nnop\nnop\nnop\nnop\n"
-#define DLY_4		"	nop\nnop\nnop\nnop\n"
-#define DLY_3		"	nop\nnop\nnop\n"
+	MAPLE_PROFILE_TX_FIRST_BIT();
 
 	asm volatile(
-		"push r31\n"
-		"push r30\n"
+		MAPLE_TX_ASM("lpm r16, z+		\n")
+		:
+		: "I" (_SFR_IO_ADDR(PORTD)), "r"(pairs), "z"(phases)
+		: "r1","r16","r17","r18","r19","r20","r21"
+	);
 
-		"mov r19, %1	\n" // Length in bytes		
-		"ldi r20, 0x01	\n" // phase 1 pin 1 high, pin 5 low
-		"ldi r21, 0x02	\n" // phase 2 pin 1 low, pin 2 high
+	inputMode();
+}
 
-		"ld r16, z+		\n"
+/* 
+ * Sender for frames whose payload is made of words stored least significant
+ * byte first: header from SRAM (X), then the payload with the bytes of each
+ * word reversed (Z walks down each word), then the LRC worked out on the
+ * way. load reads the byte at Z without moving it: ld for SRAM, lpm for
+ * flash. The last phase of each payload byte is a little longer (load and
+ * pointer update).
+ */
+#define MAPLE_TX_WORDS_ASM(load) \
+		"push r31\n" \
+		"push r30\n" \
+		"push r27\n" \
+		"push r26\n" \
+\
+		"mov r19, %1	\n" /* Payload length in bytes */ \
+		"mov r22, %2	\n" /* LRC of the header */ \
+		"ldi r20, 0x01	\n" /* phase 1 pin 1 high, pin 5 low */ \
+		"ldi r21, 0x02	\n" /* phase 2 pin 1 low, pin 2 high */ \
+		"ldi r23, 4		\n" /* header bytes */ \
+		"ldi r18, 4		\n" /* bytes left in the current payload word */ \
+		"adiw r30, 3	\n" /* last byte of the first word goes first */ \
+\
+		"ld r16, x+		\n" \
+		MAPLE_TX_PH1(7) \
+\
+		MAPLE_TX_SYNC \
+\
+		/* Header, from SRAM */ \
+"1:\n" \
+		MAPLE_TX_BYTE \
+		"dec r23		\n" /* 1 */ \
+		"breq 2f		\n" /* 1 */ \
+		"ld r16, x+		\n" /* 2 */ \
+		MAPLE_TX_PH1(7)			/* 3 */ \
+		"rjmp 1b		\n" /* 2 */ \
+\
+		/* Payload */ \
+"2:\n" \
+		load /* 2 (3 for lpm) */ \
+		"eor r22, r16	\n" /* 1 */ \
+		"sbiw r30, 1	\n" /* 2 */ \
+		"dec r18		\n" /* 1 */ \
+		MAPLE_TX_PH1(7)			/* 3 */ \
+"3:\n" \
+		MAPLE_TX_BYTE \
+		"dec r19		\n" /* 1 */ \
+		"breq 5f		\n" /* 1 */ \
+		load /* 2 (3 for lpm) */ \
+		"eor r22, r16	\n" /* 1 */ \
+		"sbiw r30, 1	\n" /* 2 */ \
+		"dec r18		\n" /* 1 */ \
+		"brne 4f		\n" /* 1/2 */ \
+		"adiw r30, 8	\n" /* 2  last byte of the next word */ \
+		"ldi r18, 4		\n" /* 1 */ \
+"4:\n" \
+		MAPLE_TX_PH1(7)			/* 3 */ \
+		"rjmp 3b		\n" /* 2 */ \
+\
+		/* LRC */ \
+"5:\n" \
+		"mov r16, r22	\n" /* 1 */ \
+		MAPLE_TX_PH1(7)			/* 3 */ \
+		MAPLE_TX_BYTE \
+\
+		MAPLE_TX_EOF \
+\
+		"pop r26		\n" \
+		"pop r27		\n" \
+		"pop r30		\n" \
+		"pop r31		\n"
 
-		// Sync
-		SET_1 SET_5 DLY_8 
-
-		CLR_1 DLY_4
-		CLR_5 DLY_3
-		
-		SET_5 DLY_3
-		CLR_5
-		DLY_3 
-		SET_5 
-		DLY_3 
-		CLR_5 
-		DLY_3
-		SET_5 
-		DLY_3 
-		CLR_5 DLY_3 SET_5
-		DLY_5 SET_1 CLR_5
+/* 
+ * Send a frame whose payload is in flash (len must be a non zero
+ * multiple of 4). Same phases as maple_transmit.
+ */
+void maple_sendRaw_P(unsigned char header_data[4], PGM_P data, unsigned char len)
+{
+	uint8_t lrc = header_data[0] ^ header_data[1] ^ header_data[2] ^ header_data[3];
 
-		// Pin 5 is low, Pin 1 is high. Ready for 1st phase
-		// Note: Coded for 16Mhz (8 cycles = 500ns)
-"next_byte:\n"
-
-		"out %0, r20	\n" // 1  initial phase 1 state
-//		"nop			\n" // 1
-		"out %0, r16	\n" // 1  data
-		"cbi %0, 0		\n" // 1  falling edge on pin 1
-		"ld r16, z+		\n" // 2  load phase 2 data
-//		"nop			\n" // 1
-		
-		"out %0, r21	\n" // 1  initial phase 2 state
-//		"nop			\n"
-		"out %0, r16	\n" // 1  data
-		"cbi %0, 1		\n" // 1  falling edge on pin 5
-		"ld r16, z+		\n" // 2
-		"dec r19		\n" // 1  Decrement counter for brne below
-		"brne next_byte	\n" // 2
+	MAPLE_PROFILE_TX_START();
 
-		// End of transmission
-		SET_1
-		DLY_4
+	// Output
+	transmitMode();
+	MAPLE_PROFILE_TX_FIRST_BIT();
 
-		SET_5 CLR_5 DLY_3
+	asm volatile(
+		MAPLE_TX_WORDS_ASM("lpm r16, z		\n")
+		:
+		: "I" (_SFR_IO_ADDR(PORTD)), "r"(len), "r"(lrc), "z"(data), "x"(header_data)
+		: "r1","r16","r17","r18","r19","r20","r21","r22","r23"
+	);
 
-		CLR_1 
-		DLY_3 
-		SET_1 
-		DLY_3 
-		CLR_1 
-		DLY_3 
-		SET_1 
-		DLY_3
-		SET_5
+	// back to input to receive the answer
+	inputMode();
+}
 
-		"pop r30		\n"
-		"pop r31		\n"
+/* 
+ * Same as maple_sendRaw_P for a payload in SRAM, in the same word layout
+ * (e.g. a block prepared in maplebuf).
+ */
+void maple_sendRawWords(unsigned char header_data[4], const unsigned char *data, unsigned char len)
+{
+	uint8_t lrc = header_data[0] ^ header_data[1] ^ header_data[2] ^ header_data[3];
 
+	MAPLE_PROFILE_TX_START();
 
+	transmitMode();
+	MAPLE_PROFILE_TX_FIRST_BIT();
+
+	asm volatile(
+		MAPLE_TX_WORDS_ASM("ld r16, z		\n")
 		:
-		: "I" (_SFR_IO_ADDR(PORTD)), "r"(buf_used/2), "z"(maplebuf)
-		: "r1","r16","r17","r18","r19","r20","r21"
+		: "I" (_SFR_IO_ADDR(PORTD)), "r"(len), "r"(lrc), "z"(data), "x"(header_data)
+		: "r1","r16","r17","r18","r19","r20","r21","r22","r23"
 	);
 
-	// back to input to receive the answer
 	inputMode();
 }
 
+void maple_sendRaw(unsigned char *data, unsigned char len)
+{
+	MAPLE_PROFILE_TX_START();
+	maple_transmit(data, len);
+}
+
+/* 
+ * Send a frame built with MAPLE_ENC_FRAME/MAPLE_ENC_FRAME1W straight from
+ * flash: no header, LRC or bit expansion work before the first bit.
+ * len is the size of the encoded frame (sizeof the array).
+ */
+void maple_sendEncoded_P(PGM_P phases, unsigned char len)
+{
+	MAPLE_PROFILE_TX_START();
+	maple_transmit_P(phases, len/2);
+}
+
 void maple_sendFrame1W(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, uint32_t data)
 {
+	MAPLE_PROFILE_TX_START();
 	uint8_t tmp[4] = { data, data >> 8, data >> 16, data >> 24 };
 	maple_sendFrame(cmd, dst_addr, src_addr, 4, tmp);
 }
@@ -615,6 +601,11 @@ void maple_sendFrame_P(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data
 {
 	unsigned char header_data[4];
 
+	if (!data_len) {
+		maple_sendFrame(cmd, dst_addr, src_addr, 0, NULL);
+		return;
+	}
+
 	header_data[0] = data_len >> 2;
 	header_data[1] = src_addr;
 	header_data[2] = dst_addr;
@@ -624,24 +615,56 @@ void maple_sendFrame_P(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data
 	maple_sendRaw_P(header_data, data, data_len);
 }
 
+/* 
+ * data is in SRAM, words least significant byte first like maple_sendFrame_P
+ * (data_len must be a multiple of 4)
+ */
+void maple_sendFrameWords(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data_len, const uint8_t *data)
+{
+	unsigned char header_data[4];
+
+	if (!data_len) {
+		maple_sendFrame(cmd, dst_addr, src_addr, 0, NULL);
+		return;
+	}
+
+	header_data[0] = data_len >> 2;
+	header_data[1] = src_addr;
+	header_data[2] = dst_addr;
+	header_data[3] = cmd;
+
+	maple_sendRawWords(header_data, data, data_len);
+}
+
 /* 
  * data is in bus order
  */
 void maple_sendFrame(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data_len, uint8_t *data)
 {
-	unsigned char tmp[4 + data_len + 1];
+	// Put together in the arena instead of the stack, it is free until
+	// the capture of the reply starts
+	unsigned char *tmp = ARENA;
 	uint8_t lrc=0;
 	int i;
 	int len = 4 + data_len + 1;
 
+	ARENA_FITS(255, "The longest frame maple_sendRaw takes");
+	if (len > 255)
+		return;
+
+	MAPLE_PROFILE_TX_START();
+	Arena_Claim(ARENA_MAPLE_TX);
+
+	// The payload may already be in the arena (e.g. a radio read), so
+	// move it up before the header overwrites its first bytes
+	if (data_len) {
+		memmove(tmp + 4, data, data_len);
+	}
+
 	tmp[0] = data_len >> 2;
 	tmp[1] = src_addr;
 	tmp[2] = dst_addr;
 	tmp[3] = cmd;
-
-	if (data_len) {
-		memcpy(tmp + 4, data, data_len);
-	}
 	
 	for (lrc=0, i=0; i<data_len+4; i++) {
 		lrc ^= tmp[i];
@@ -649,5 +672,6 @@ void maple_sendFrame(uint8_t cmd, uint8_t dst_addr, uint8_t src_addr, int data_l
 
 	tmp[i] = lrc;
 	
-	maple_sendRaw(tmp, len);	
+	maple_sendRaw(tmp, len);
+	Arena_Release(ARENA_MAPLE_TX);
 }
\ No newline at end of file
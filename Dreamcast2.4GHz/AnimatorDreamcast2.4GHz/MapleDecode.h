@@ -0,0 +1,299 @@
+/* Dreamcast to USB : Sega dc controllers to USB adapter
+ * Copyright (C) 2013 Raphal Assnat
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * The author may be contacted at raph@raphnet.net
+ */
+
+/*
+ * Maple bus reply decoder. Plain C with no AVR dependencies so the same
+ * code runs on the adapter and in the host tools (benchmark, capture viewer).
+ *
+ * The includer may define before including:
+ *   MAPLE_CAPTURE_PACKED   samples are packed two per byte (upper nibble first)
+ *   MAPLE_TRACE_MARK()     called at the start and end of decoding
+ *   MAPLE_TRACE_BIT(v)     called with each decoded bit
+ *   MAPLE_TRACE_SAMPLE(v)  called with each sample (branch decoder only)
+ *   MAPLE_TRACE_GLITCH()   called when both pins fall at the same time
+ */
+#ifndef MAPLE_DECODE_H
+#define MAPLE_DECODE_H
+
+#ifdef __AVR__
+#include <avr/pgmspace.h>
+#define MAPLE_LUT_ATTR	PROGMEM
+#define MAPLE_LUT_READ(i)	pgm_read_byte(&maple_decode_table[i])
+#else
+#define MAPLE_LUT_ATTR
+#define MAPLE_LUT_READ(i)	(maple_decode_table[i])
+#endif
+
+// Read sample i (pin 1 in bit 0, pin 5 in bit 1) from a capture buffer
+#ifdef MAPLE_CAPTURE_PACKED
+#define MAPLE_DECODE_SAMPLE(buf, i)	(((buf)[(i)>>1] >> (((i)&1) ? 0 : 4)) & 0x03)
+#else
+#define MAPLE_DECODE_SAMPLE(buf, i)	((buf)[i] & 0x03)
+#endif
+
+#ifndef MAPLE_TRACE_MARK
+#define MAPLE_TRACE_MARK()
+#endif
+#ifndef MAPLE_TRACE_BIT
+#define MAPLE_TRACE_BIT(v)
+#endif
+#ifndef MAPLE_TRACE_SAMPLE
+#define MAPLE_TRACE_SAMPLE(v)
+#endif
+#ifndef MAPLE_TRACE_GLITCH
+#define MAPLE_TRACE_GLITCH()
+#endif
+
+/*
+ * Transition table indexed by (last_fell << 4) | (last << 2) | cur.
+ *
+ *   0                 no pin fell (or nothing changed), keep going
+ *   MAPLE_LUT_END     the same pin fell twice in a row: end of frame
+ *   otherwise         a bit: bits 0-1 hold the pin(s) that fell, bit 2 the data
+ */
+#define MAPLE_LUT_END	0x80
+#define MAPLE_LUT_DATA	0x04
+#define MAPLE_LUT_FELL	0x03
+
+#define MAPLE_LUT_ENTRY(lf, l, c) \
+	(((l) & ((l) ^ (c))) == 0 ? 0 : \
+	 ((l) & ((l) ^ (c))) == (lf) ? MAPLE_LUT_END : \
+	 (((l) & ((l) ^ (c))) | ((c) ? MAPLE_LUT_DATA : 0)))
+#define MAPLE_LUT_ROW(lf, l) \
+	MAPLE_LUT_ENTRY(lf, l, 0), MAPLE_LUT_ENTRY(lf, l, 1), MAPLE_LUT_ENTRY(lf, l, 2), MAPLE_LUT_ENTRY(lf, l, 3)
+#define MAPLE_LUT_BLOCK(lf) \
+	MAPLE_LUT_ROW(lf, 0), MAPLE_LUT_ROW(lf, 1), MAPLE_LUT_ROW(lf, 2), MAPLE_LUT_ROW(lf, 3)
+
+static const unsigned char maple_decode_table[64] MAPLE_LUT_ATTR = {
+	MAPLE_LUT_BLOCK(0), MAPLE_LUT_BLOCK(1), MAPLE_LUT_BLOCK(2), MAPLE_LUT_BLOCK(3)
+};
+
+// Skip what we got of the sync/start of frame sequence: find the
+// initial phase 1 (Pin 1 high, Pin 5 low). Returns nsamples if not found.
+static inline unsigned int maple_decode_start(const volatile unsigned char *buf, unsigned int nsamples)
+{
+	unsigned int i;
+
+	for (i=0; i<nsamples; i++) {
+		if (MAPLE_DECODE_SAMPLE(buf, i) == 0x01)
+			break;
+	}
+	return i;
+}
+
+// End of frame: check the length and LRC, put the lrc byte in place.
+static inline int maple_decode_finish(unsigned char *data, unsigned int dst_pos, unsigned int count,
+				unsigned char word_pos, unsigned char lrc_byte, unsigned char lrc)
+{
+	if (count == 0)
+		return 0;
+
+	// A packet contains n groups of 4 bytes, plus 1 byte crc.
+	if (word_pos != 1) {
+		return -2; // frame error
+	}
+	data[dst_pos] = lrc_byte; // lrc byte, not reversed
+
+#ifndef NOLRC
+	if (lrc)
+		return -2; // LRC error
+#else
+	(void)lrc;
+#endif
+
+	return count-1; // remove lrc
+}
+
+/**
+ * Decode a capture one sample at a time, testing each transition with
+ * branches. Each completed byte is folded into the LRC and stored in its
+ * final position (each group of 4 bytes reversed).
+ *
+ * \return -1 on timeout, -2 lrc/frame error, -3 too much data. Otherwise the number of bytes received (lrc removed)
+ */
+static inline int maple_decode_branch(const volatile unsigned char *buf, unsigned int nsamples,
+				unsigned char *data, unsigned int maxlen)
+{
+	unsigned char dst_b;
+	unsigned char cur_byte;
+	unsigned char word[4];
+	unsigned char word_pos;
+	unsigned char lrc;
+	unsigned int dst_pos;
+	unsigned int count;
+	unsigned char last;
+	unsigned char last_fell;
+	unsigned int i;
+
+	MAPLE_TRACE_MARK();
+
+	i = maple_decode_start(buf, nsamples);
+	if (i==nsamples) {
+		return -1; // timeout
+	}
+
+	dst_pos = 0;	// start of the word being assembled
+	count = 0;		// complete bytes received
+	word_pos = 0;
+	lrc = 0;
+	cur_byte = 0;
+	dst_b = 0x80;
+	last = MAPLE_DECODE_SAMPLE(buf, i);
+	last_fell = 0;
+	for (; i<nsamples; i++) {
+		unsigned char fell;
+		unsigned char cur = MAPLE_DECODE_SAMPLE(buf, i);
+
+		MAPLE_TRACE_SAMPLE(cur & 1);
+
+		if (cur == last) {
+			continue; // no change
+		}
+
+		fell = last & (cur ^ last);
+
+		if (!fell) {
+			// pin(s) changed, but none fell.
+			last = cur;
+			continue;
+		}
+
+		if (fell == last_fell) {
+			// two identical consecutive phases marks the end of the packet.
+			MAPLE_TRACE_MARK();
+			break;
+		}
+
+		// when any of the two pins fall, the
+		// other pin is the data.
+		if (fell == 0x03) {
+			// two pins at the same time!
+			MAPLE_TRACE_GLITCH();
+		}
+
+		if (cur) {
+			cur_byte |= dst_b;
+		}
+		MAPLE_TRACE_BIT(cur);
+		
+		dst_b >>= 1;
+		if (!dst_b) {
+			// Byte complete: fold it in the LRC and keep it until its word is complete
+			dst_b = 0x80;
+			lrc ^= cur_byte;
+			word[word_pos++] = cur_byte;
+			cur_byte = 0;
+			if (word_pos == 4) {
+				// Reverse the group of 4 bytes on the way out
+				data[dst_pos] = word[3];
+				data[dst_pos+1] = word[2];
+				data[dst_pos+2] = word[1];
+				data[dst_pos+3] = word[0];
+				dst_pos += 4;
+				word_pos = 0;
+			}
+			count++;
+			if (count >= maxlen) {
+				MAPLE_TRACE_BIT(0);
+				return -3;
+			}
+		}
+
+		last_fell = fell;
+		last = cur;
+	}
+
+	MAPLE_TRACE_BIT(0);
+
+	return maple_decode_finish(data, dst_pos, count, word_pos, word[0], lrc);
+}
+
+/**
+ * Same result as maple_decode_branch, but every (last_fell, last, cur)
+ * combination is looked up in maple_decode_table so the common case (no
+ * pin fell) costs a single test per sample.
+ */
+static inline int maple_decode_lut(const volatile unsigned char *buf, unsigned int nsamples,
+				unsigned char *data, unsigned int maxlen)
+{
+	unsigned char acc;
+	unsigned char word[4];
+	unsigned char word_pos;
+	unsigned char lrc;
+	unsigned int dst_pos;
+	unsigned int count;
+	unsigned char state;	// (last_fell << 4) | (last << 2)
+	unsigned int i;
+
+	MAPLE_TRACE_MARK();
+
+	i = maple_decode_start(buf, nsamples);
+	if (i==nsamples) {
+		return -1; // timeout
+	}
+
+	dst_pos = 0;
+	count = 0;
+	word_pos = 0;
+	lrc = 0;
+	acc = 0x01;	// marker bit, shifted out when the byte is complete
+	state = MAPLE_DECODE_SAMPLE(buf, i) << 2;
+	for (; i<nsamples; i++) {
+		unsigned char cur = MAPLE_DECODE_SAMPLE(buf, i);
+		unsigned char t = MAPLE_LUT_READ(state | cur);
+
+		if (!t) {
+			state = (state & 0x30) | (cur << 2);
+			continue;
+		}
+		if (t & MAPLE_LUT_END) {
+			MAPLE_TRACE_MARK();
+			break;
+		}
+		state = ((t & MAPLE_LUT_FELL) << 4) | (cur << 2);
+
+		if (acc & 0x80) {
+			// Eighth bit: fold the byte in the LRC and keep it until its word is complete
+			acc = (acc << 1) | ((t & MAPLE_LUT_DATA) ? 1 : 0);
+			lrc ^= acc;
+			word[word_pos++] = acc;
+			acc = 0x01;
+			if (word_pos == 4) {
+				data[dst_pos] = word[3];
+				data[dst_pos+1] = word[2];
+				data[dst_pos+2] = word[1];
+				data[dst_pos+3] = word[0];
+				dst_pos += 4;
+				word_pos = 0;
+			}
+			count++;
+			if (count >= maxlen) {
+				return -3;
+			}
+		}
+		else {
+			acc = (acc << 1) | ((t & MAPLE_LUT_DATA) ? 1 : 0);
+		}
+	}
+
+	return maple_decode_finish(data, dst_pos, count, word_pos, word[0], lrc);
+}
+
+#endif
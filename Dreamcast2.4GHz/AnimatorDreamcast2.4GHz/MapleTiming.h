@@ -0,0 +1,157 @@
+/* Dreamcast to USB : Sega dc controllers to USB adapter
+ * Copyright (C) 2013 Raphal Assnat
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * The author may be contacted at raph@raphnet.net
+ */
+
+/*
+ * Maple bus timing. Plain preprocessor so the host check
+ * (Tools/maple_timing_check.cpp) runs the exact instructions the
+ * adapter sends.
+ *
+ * Only 16MHz is supported. The sync and end of frame pulses are padded
+ * with nops (DLY_8 is 500ns), but the data phases are a fixed
+ * instruction sequence, MAPLE_TX_PHASE_CYCLES long (plus up to
+ * MAPLE_TX_GAP_MAX_CYCLES at byte boundaries), and the sampler period
+ * comes from the generated rxcode.h / rxcode_packed.h
+ * (MAPLE_RX_CYCLES). Neither scales with the clock: at 8MHz the sampler
+ * (375ns) and the byte boundary phase (2750ns) are out of spec, and
+ * 12/20MHz would need their own samplers and phase padding. Any other
+ * clock stops the adapter build (the host check reports it instead).
+ *
+ * MapleBus.h also checks the numbers below against the MAPLE_SPEC_*
+ * limits with _Static_assert.
+ */
+#ifndef MAPLE_TIMING_H
+#define MAPLE_TIMING_H
+
+// Limits the sender and sampler are held to (ns)
+#define MAPLE_SPEC_PHASE_MIN_NS		250		// fastest data phase (clock edge to clock edge)
+#define MAPLE_SPEC_PHASE_MAX_NS		2000	// slowest data phase, byte boundaries included
+#define MAPLE_SPEC_SETUP_NS			50		// data stable before the clock edge
+#define MAPLE_SPEC_SYNC_PULSE_NS	250		// shortest pulse of the start/end of frame patterns
+#define MAPLE_SPEC_SAMPLE_MAX_NS	250		// replies have states this short, the sampler must see each one
+
+#define MAPLE_TX_PHASE_CYCLES		7		// out, out, cbi (2), next phase worked out (3)
+#define MAPLE_TX_GAP_MAX_CYCLES		15		// longest extra time between two bytes (flash payload, next word)
+
+#define MAPLE_NOP1	"	nop\n"
+#define MAPLE_NOP2	MAPLE_NOP1 MAPLE_NOP1
+#define MAPLE_NOP3	MAPLE_NOP2 MAPLE_NOP1
+#define MAPLE_NOP4	MAPLE_NOP2 MAPLE_NOP2
+#define MAPLE_NOP5	MAPLE_NOP4 MAPLE_NOP1
+#define MAPLE_NOP8	MAPLE_NOP4 MAPLE_NOP4
+
+#if F_CPU == 16000000UL
+#define MAPLE_TIMING_SUPPORTED	1
+#define DLY_8		MAPLE_NOP8
+#define DLY_5		MAPLE_NOP5
+#define DLY_4		MAPLE_NOP4
+#define DLY_3		MAPLE_NOP3
+#define MAPLE_DLY_SYNC_CYCLES	3	// DLY_3, the shortest padding in a pulse
+#else
+#define MAPLE_TIMING_SUPPORTED	0
+#define DLY_8		""
+#define DLY_5		""
+#define DLY_4		""
+#define DLY_3		""
+#define MAPLE_DLY_SYNC_CYCLES	0
+#ifdef __AVR__
+#error "The Maple bus timing only works at 16MHz (see MapleTiming.h), build with F_CPU=16000000UL"
+#endif
+#endif
+
+// Time in ns of a number of cycles, rounded up (clocks are whole MHz)
+#define MAPLE_CYCLES_NS(cycles)	(((cycles) * 1000UL + F_CPU / 1000000UL - 1) / (F_CPU / 1000000UL))
+
+// DC controller pin 1 and pin 5
+#define SET_1		"	sbi %0, 0\n"
+#define CLR_1		"	cbi %0, 0\n"
+#define SET_5		"	sbi %0, 1\n"
+#define CLR_5		"	cbi %0, 1\n"
+
+/* Start of frame, both lines high on entry. Ends with pin 1 high, pin 5 low. */
+#define MAPLE_TX_SYNC \
+		SET_1 SET_5 DLY_8 \
+\
+		CLR_1 DLY_4 \
+		CLR_5 DLY_3 \
+\
+		SET_5 DLY_3 \
+		CLR_5 \
+		DLY_3 \
+		SET_5 \
+		DLY_3 \
+		CLR_5 \
+		DLY_3 \
+		SET_5 \
+		DLY_3 \
+		CLR_5 DLY_3 SET_5 \
+		DLY_5 SET_1 CLR_5
+
+/* End of frame, leaves both lines high. */
+#define MAPLE_TX_EOF \
+		SET_1 \
+		DLY_4 \
+\
+		SET_5 CLR_5 DLY_3 \
+\
+		CLR_1 \
+		DLY_3 \
+		SET_1 \
+		DLY_3 \
+		CLR_1 \
+		DLY_3 \
+		SET_1 \
+		DLY_3 \
+		SET_5
+
+/* 
+ * Work out the PORTD value of the next phase from one bit of r16 in
+ * r17: the clock pin high, the other pin carries the data. Always 3
+ * cycles (sbrc takes 2 when it skips the ldi).
+ */
+#define MAPLE_TX_PH1(bit) \
+		"ldi r17, 0x01	\n" \
+		"sbrc r16, " #bit "	\n" \
+		"ldi r17, 0x03	\n"
+#define MAPLE_TX_PH2(bit) \
+		"ldi r17, 0x02	\n" \
+		"sbrc r16, " #bit "	\n" \
+		"ldi r17, 0x03	\n"
+
+/* Two bits: phase 1 data must already be in r17 */
+#define MAPLE_TX_PAIR(bit2) \
+		"out %0, r20	\n" /* 1  initial phase 1 state */ \
+		"out %0, r17	\n" /* 1  data */ \
+		"cbi %0, 0		\n" /* 1  falling edge on pin 1 */ \
+		MAPLE_TX_PH2(bit2) /* 3 */ \
+		"out %0, r21	\n" /* 1  initial phase 2 state */ \
+		"out %0, r17	\n" /* 1  data */ \
+		"cbi %0, 1		\n" /* 1  falling edge on pin 5 */
+
+/* One byte from r16, phase 1 data of bit 7 must already be in r17 */
+#define MAPLE_TX_BYTE \
+		MAPLE_TX_PAIR(6)		/* 12 cycles per pair */ \
+		MAPLE_TX_PH1(5) \
+		MAPLE_TX_PAIR(4) \
+		MAPLE_TX_PH1(3) \
+		MAPLE_TX_PAIR(2) \
+		MAPLE_TX_PH1(1) \
+		MAPLE_TX_PAIR(0)
+
+#endif // MAPLE_TIMING_H
@@ -0,0 +1,129 @@
+//-----------------------------------------------------------------------------
+//
+//  Scheduler.h
+//
+//  Swallowtail Task Scheduler Firmware
+//  AVR (ATmega168PB) Cooperative Deadline Scheduler Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+#define SCHEDULER_TASKS 4 //Most tasks that can be added
+#define SCHEDULER_FULL 0xFF //Returned by Scheduler_Add when every slot is taken
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h> //Timer.h has to be included first
+
+/******************* Globals *****************************/
+
+//A task is a function that does one step of its work and returns, it never waits
+typedef struct SchedulerTask {
+	void (*run)(void); //Step function
+	uint16_t period; //Milliseconds between two runs (0 = on every pass)
+	uint16_t deadline; //Milliseconds a run may start after it was due before it counts as a miss
+	uint32_t due; //Time the next run is due (ms)
+	uint16_t runs; //Times the task was run
+	uint16_t misses; //Runs that started past their deadline
+	uint16_t runtime_max; //Longest run (Timer1 ticks)
+	uint32_t runtime_total; //Time spent in the task (Timer1 ticks)
+} SchedulerTask;
+
+static SchedulerTask sched_tasks[SCHEDULER_TASKS];
+static uint8_t sched_count = 0; //Tasks added
+
+/******************** Functions **************************/
+
+//Add a task, returns its number for Scheduler_Stats (SCHEDULER_FULL if there is no room, the task is not added)
+uint8_t Scheduler_Add(void (*run)(void), uint16_t period, uint16_t deadline){
+	SchedulerTask *task;
+	if(sched_count >= SCHEDULER_TASKS){
+		return SCHEDULER_FULL;
+	}
+	task = &sched_tasks[sched_count];
+	task->run = run;
+	task->period = period;
+	task->deadline = deadline;
+	task->due = Timer_Millis();
+	return sched_count++;
+}
+
+//Give every due task one run, in the order they were added
+void Scheduler_Run(){
+	uint8_t i;
+	for(i=0; i<sched_count; i++){
+		SchedulerTask *task = &sched_tasks[i];
+		uint32_t now = Timer_Millis();
+		uint16_t start, runtime;
+		if((int32_t)(now - task->due) < 0){
+			continue;
+		}
+		if(now - task->due > task->deadline){
+			task->misses++;
+		}
+		start = Timer_Now();
+		task->run();
+		runtime = Timer_Now() - start;
+		task->runs++;
+		task->runtime_total += runtime;
+		if(runtime > task->runtime_max){
+			task->runtime_max = runtime;
+		}
+		//Keep periodic tasks on their grid, unless they fell a whole period behind
+		task->due += task->period;
+		if((int32_t)(Timer_Millis() - task->due) > (int32_t)task->period){
+			task->due = Timer_Millis();
+		}
+	}
+	return; //Return to call point
+}
+
+//Number of tasks added (task numbers run from 0 to this - 1)
+uint8_t Scheduler_Count(){
+	return sched_count;
+}
+
+//Read back the counters of a task
+const SchedulerTask *Scheduler_Stats(uint8_t id){
+	return &sched_tasks[id];
+}
+
+//Start a new measurement window
+void Scheduler_ResetStats(){
+	uint8_t i;
+	for(i=0; i<sched_count; i++){
+		sched_tasks[i].runs = 0;
+		sched_tasks[i].misses = 0;
+		sched_tasks[i].runtime_max = 0;
+		sched_tasks[i].runtime_total = 0;
+	}
+	return; //Return to call point
+}
+
+/******************** Interrupt Service Routines *********/
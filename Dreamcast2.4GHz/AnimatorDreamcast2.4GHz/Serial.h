@@ -0,0 +1,150 @@
+//-----------------------------------------------------------------------------
+//
+//  Serial.h
+//
+//  Swallowtail Serial Debug Output Firmware
+//  AVR (ATmega168PB) Bit-Banged UART Transmit Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+#ifndef SERIAL_H
+#define SERIAL_H
+
+/******************** Macros *****************************/
+
+//The hardware USART sits on PD0/PD1, which are the Maple bus, so the debug output is bit-banged
+#define SERIAL_BAUD 57600 //8N1, idle high
+#define SERIAL_BIT_TICKS ((F_CPU / TIMER_PRESCALE + SERIAL_BAUD / 2) / SERIAL_BAUD) //Timer1 ticks per bit (35 at 16MHz, 0.8% slow)
+
+//Framing shared with the host tools: sync, type, length (little endian), payload, CRC-16/CCITT of everything after the sync
+#define SERIAL_SYNC0 0xA5
+#define SERIAL_SYNC1 0x5A
+#define SERIAL_HEADER_SIZE 5 //Sync, type and length
+#define SERIAL_CRC_INIT 0xFFFF
+
+//Frame types
+#define SERIAL_TYPE_CAPTURE 0x01 //A Maple capture (see CaptureDump.h)
+#define SERIAL_TYPE_STATS 0x02 //Scheduler and Maple error counters (see statsTask in main.c)
+
+//Physical Pin Macros
+#define DDR_Serial DDRC
+#define PORT_Serial PORTC
+#define TX_Serial PC3 //Pin 26, the only spare pin not on PORTD (the Maple senders write the whole of PORTD)
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <stdint.h>
+#ifdef __AVR__
+#include <avr/io.h> //Timer.h has to be included first
+#endif
+
+/******************* Globals *****************************/
+
+#ifdef __AVR__
+static uint16_t serial_crc; //CRC of the frame being sent
+#endif
+
+/******************** Functions **************************/
+
+//Fold one byte into a CRC-16/CCITT (polynomial 0x1021, no reflection), same as the host side
+static inline uint16_t Serial_CRC(uint16_t crc, uint8_t byte){
+	uint8_t i;
+	crc ^= (uint16_t)byte << 8;
+	for(i=0; i<8; i++){
+		crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+	}
+	return crc;
+}
+
+#ifdef __AVR__
+_Static_assert(SERIAL_BIT_TICKS * SERIAL_BAUD * 50 > F_CPU / TIMER_PRESCALE * 49 &&
+	SERIAL_BIT_TICKS * SERIAL_BAUD * 50 < F_CPU / TIMER_PRESCALE * 51, "SERIAL_BAUD is more than 2% off at this F_CPU");
+
+//Drive the transmit pin to the idle level (Timer1 must already be running)
+void Serial_init(){
+	PORT_Serial |= (1<<TX_Serial);
+	DDR_Serial |= (1<<TX_Serial);
+	return; //Return to call point
+}
+
+//Send one byte, each bit edge placed on a Timer1 deadline so the rounding never adds up over the byte
+void Serial_Write(uint8_t byte){
+	//Start bit, 8 data bits LSB first, stop bit
+	uint16_t bits = ((uint16_t)byte << 1) | (1<<9);
+	uint16_t next;
+	uint8_t i;
+	uint8_t sreg = SREG;
+	//About 175us with interrupts off, only call it while the Maple bus is idle
+	cli();
+	next = Timer_Now();
+	for(i=0; i<10; i++){
+		if(bits & 1){
+			PORT_Serial |= (1<<TX_Serial);
+		}
+		else{
+			PORT_Serial &= ~(1<<TX_Serial);
+		}
+		bits >>= 1;
+		next += SERIAL_BIT_TICKS;
+		while((int16_t)(Timer_Now() - next) < 0);
+	}
+	SREG = sreg;
+	return; //Return to call point
+}
+
+//Start a frame of a given type and payload length
+void Serial_FrameBegin(uint8_t type, uint16_t length){
+	Serial_Write(SERIAL_SYNC0);
+	Serial_Write(SERIAL_SYNC1);
+	serial_crc = Serial_CRC(SERIAL_CRC_INIT, type);
+	serial_crc = Serial_CRC(serial_crc, length & 0xFF);
+	serial_crc = Serial_CRC(serial_crc, length >> 8);
+	Serial_Write(type);
+	Serial_Write(length & 0xFF);
+	Serial_Write(length >> 8);
+	return; //Return to call point
+}
+
+//Send one payload byte
+void Serial_FrameByte(uint8_t byte){
+	serial_crc = Serial_CRC(serial_crc, byte);
+	Serial_Write(byte);
+	return; //Return to call point
+}
+
+//Close the frame with its CRC (little endian)
+void Serial_FrameEnd(){
+	Serial_Write(serial_crc & 0xFF);
+	Serial_Write(serial_crc >> 8);
+	return; //Return to call point
+}
+#endif
+
+/******************** Interrupt Service Routines *********/
+
+#endif
@@ -0,0 +1,108 @@
+//-----------------------------------------------------------------------------
+//
+//  Snapshot.h
+//
+//  Swallowtail Controller Snapshot Firmware
+//  Double Buffered Controller Snapshot Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+
+/******************** Macros *****************************/
+
+//Largest controller state that can be passed through a snapshot
+#ifndef SNAPSHOT_SIZE
+#define SNAPSHOT_SIZE 8
+#endif
+
+//Keep the compiler from moving slot accesses across the sequence counters
+#define SNAPSHOT_BARRIER() asm volatile("" ::: "memory")
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+#include <util/atomic.h>
+#include <string.h>
+
+/******************* Globals *****************************/
+
+//Ping-pong buffer between the pad poll (writer) and the radio sender (reader)
+typedef struct Snapshot {
+	uint8_t slot[2][SNAPSHOT_SIZE]; //The writer always fills the slot the reader is not pointed at
+	volatile uint8_t seq[2]; //Incremented before and after each write (odd = write in progress)
+	volatile uint8_t latest; //Slot holding the newest complete sample
+	volatile uint8_t fresh; //Set while latest has not been taken by the reader
+	volatile uint16_t published; //Samples written
+	volatile uint16_t taken; //Samples handed to the reader
+	volatile uint16_t superseded; //Samples overwritten before the reader took them
+} Snapshot;
+
+/******************** Functions **************************/
+
+//Store a new sample (call from the poll ISR or the poll task)
+void Snapshot_Publish(Snapshot *snap, const void *data, uint8_t length){
+	uint8_t i = snap->latest ^ 1;
+	snap->seq[i]++;
+	SNAPSHOT_BARRIER();
+	memcpy(snap->slot[i], data, length);
+	SNAPSHOT_BARRIER();
+	snap->seq[i]++;
+	snap->latest = i;
+	//The previous sample was never picked up
+	if(snap->fresh){
+		snap->superseded++;
+	}
+	snap->fresh = 1;
+	snap->published++;
+}
+
+//Copy out the newest complete sample, returns 0 if nothing new arrived since the last call
+uint8_t Snapshot_Take(Snapshot *snap, void *data, uint8_t length){
+	uint8_t i, seq;
+	if(!snap->fresh){
+		return 0;
+	}
+	//Retry if the writer lapped the reader and rewrote the slot during the copy
+	do{
+		i = snap->latest;
+		seq = snap->seq[i];
+		SNAPSHOT_BARRIER();
+		memcpy(data, snap->slot[i], length);
+		SNAPSHOT_BARRIER();
+	} while((seq & 0x01) || seq != snap->seq[i]);
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+		//Only clear fresh if no newer sample was published while copying
+		if(snap->latest == i){
+			snap->fresh = 0;
+		}
+		snap->taken++;
+	}
+	return 1;
+}
+
+/******************** Interrupt Service Routines *********/
@@ -1,12 +0,0 @@
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x09, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x06,
-0x02, 0x00, 0x00, 0x00, 0x00, 0x05, 0x01, 0x38, 0x00, 0x00, 0x00, 0x05, 0x34, 0xE8, 0x00, 0x00,
-0x00, 0x05, 0x12, 0x68, 0x00, 0x00, 0x00, 0x05, 0x09, 0x2C, 0x00, 0x00, 0x00, 0x05, 0x08, 0xB4,
-0x00, 0x00, 0x00, 0x05, 0x24, 0xB5, 0x00, 0x00, 0x00, 0x02, 0xA2, 0xBD, 0x00, 0x00, 0x00, 0x02,
-0xFF, 0xE6, 0x40, 0x00, 0x00, 0x02, 0x80, 0x7B, 0x50, 0x00, 0x00, 0x02, 0x80, 0x8D, 0x90, 0x00,
-0x00, 0x02, 0xBF, 0x1A, 0xA0, 0x00, 0x00, 0x05, 0x00, 0x25, 0x40, 0x00, 0x00, 0x05, 0x00, 0x46,
-0xE0, 0x00, 0x00, 0x05, 0x3F, 0x89, 0xA0, 0x00, 0x00, 0x0A, 0x01, 0x19, 0xF0, 0x00, 0x00, 0x0A,
-0x02, 0x29, 0xA8, 0x00, 0x00, 0x0A, 0x04, 0x69, 0x28, 0x00, 0x00, 0x0A, 0xF8, 0xA9, 0x14, 0x00,
-0x00, 0x0A, 0x09, 0x2A, 0x14, 0x00, 0x00, 0x0A, 0x12, 0x2A, 0x10, 0x00, 0x00, 0x0A, 0x24, 0x2A,
-0x10, 0x00, 0x00, 0x0A, 0xC8, 0x2C, 0x00, 0x00, 0x00, 0x0A, 0x10, 0x2C, 0x00, 0x00, 0x00, 0x0B,
-0xF0, 0x2C, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
\ No newline at end of file
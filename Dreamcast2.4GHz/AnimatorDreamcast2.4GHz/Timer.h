@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+//
+//  Timer.h
+//
+//  Swallowtail Timer Firmware
+//  AVR (ATmega168PB) Free Running Timebase Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+
+/******************** Macros *****************************/
+
+#define TIMER_PRESCALE 8 //Timer1 runs at F_CPU/8
+#define TIMER_TICKS_PER_MS (F_CPU / TIMER_PRESCALE / 1000UL) //2000 ticks per millisecond at 16MHz (1500 at 12MHz, 2500 at 20MHz)
+#define TIMER_US_TICKS(us) (((uint32_t)(us) * TIMER_TICKS_PER_MS + 500) / 1000) //Convert microseconds to ticks (rounded)
+#define TIMER_CYCLES(ticks) ((uint32_t)(ticks) * TIMER_PRESCALE) //Convert ticks to CPU cycles
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+
+/******************* Globals *****************************/
+
+//Millisecond clock kept up from Timer1 readings (no overflow interrupt, it would delay the Maple capture)
+static uint32_t timer_ms = 0; //Milliseconds counted so far
+static uint16_t timer_last = 0; //Timer1 at the last update
+static uint16_t timer_frac = 0; //Ticks not yet making up a whole millisecond
+
+/******************** Functions **************************/
+
+//Start Timer1 free running (wraps every 65536 ticks, 32.8ms at 16MHz)
+void Timer_init(){
+	TCCR1A = 0x00;
+	TCCR1B = (1<<CS11);
+	return; //Return to call point
+}
+
+//Current tick count, subtract two readings for an interval shorter than one wrap
+uint16_t Timer_Now(){
+	return TCNT1;
+}
+
+//Milliseconds since Timer_init. Has to be called at least once per Timer1 wrap (32.8ms) or the time in between is lost
+uint32_t Timer_Millis(){
+	uint16_t now = TCNT1;
+	uint32_t ticks = timer_frac + (uint16_t)(now - timer_last);
+	timer_last = now;
+	//Called often, so this is rarely more than one pass (cheaper than a 32 bit division)
+	while(ticks >= TIMER_TICKS_PER_MS){
+		ticks -= TIMER_TICKS_PER_MS;
+		timer_ms++;
+	}
+	timer_frac = ticks;
+	return timer_ms;
+}
+
+/******************** Interrupt Service Routines *********/
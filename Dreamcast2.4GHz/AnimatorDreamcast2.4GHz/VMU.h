@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+//
+//  VMU.h
+//
+//  Swallowtail VMU Screen Firmware
+//  AVR (ATmega168PB) VMU LCD Asset Playback Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+#define VMU_KEY 0x00 //Frame holds the whole bitmap
+#define VMU_DELTA 0x01 //Frame is XORed with the frame before it
+
+#define VMU_FB_SIZE 192 //48x32 pixels, one bit each
+#define VMU_BLOCK_HEADER 8 //LCD function code and block number in front of the bitmap
+#define VMU_BLOCK_SIZE (VMU_BLOCK_HEADER + VMU_FB_SIZE)
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+//Needs MapleBus.h (included by Dreamcast.h before this file)
+#include "VMUBanner.h"
+
+/******************* Globals *****************************/
+
+//The block is put together in the arena (ARENA_VMU phase): it is free between a transmit and the next capture
+#define vmu_block ARENA
+#define vmu_fb (vmu_block + VMU_BLOCK_HEADER)
+ARENA_FITS(VMU_BLOCK_SIZE, "The VMU LCD block");
+
+static const uint8_t vmu_block_header[VMU_BLOCK_HEADER] PROGMEM = {
+	0x00, 0x00, 0x00, 0x04, //LCD function code ($004)
+	0x00, 0x00, 0x00, 0x00 //Partition 0, phase 0, block 0
+};
+
+/******************** Functions **************************/
+
+//Decompress one frame into the frame buffer, XORing it in if it is a delta. Returns the byte after the frame
+static const uint8_t *VMU_DecodeFrame(const uint8_t *src){
+	uint8_t type = pgm_read_byte(src++);
+	uint8_t *dst = vmu_fb;
+	uint8_t *end = vmu_fb + VMU_FB_SIZE;
+	while(dst < end){
+		uint8_t c = pgm_read_byte(src++);
+		if(c & 0x80){
+			//Run: the next byte repeated
+			uint8_t n = c - 0x80 + 2;
+			uint8_t v = pgm_read_byte(src++);
+			while(n--){
+				*dst = (type == VMU_DELTA) ? (*dst ^ v) : v;
+				dst++;
+			}
+		}
+		else{
+			//Literal bytes
+			uint8_t n = c + 1;
+			while(n--){
+				uint8_t v = pgm_read_byte(src++);
+				*dst = (type == VMU_DELTA) ? (*dst ^ v) : v;
+				dst++;
+			}
+		}
+	}
+	return src;
+}
+
+//Rebuild a frame of an asset in the frame buffer: decode the key frame at or before it, then the deltas up to it
+void VMU_Decode(const uint8_t *asset, const uint16_t *index, uint8_t frame){
+	uint8_t key = frame;
+	Arena_Claim(ARENA_VMU);
+	while(key && pgm_read_byte(asset + pgm_read_word(&index[key])) != VMU_KEY){
+		key--;
+	}
+	const uint8_t *src = asset + pgm_read_word(&index[key]);
+	do{
+		src = VMU_DecodeFrame(src);
+	} while(key++ != frame);
+	return; //Return to call point
+}
+
+//Send the frame buffer to the VMU LCD at the given Maple address (Block write, Code 12)
+void VMU_Write(uint8_t addr){
+	Arena_Claim(ARENA_VMU);
+	memcpy_P(vmu_block, vmu_block_header, VMU_BLOCK_HEADER);
+	maple_sendFrameWords(MAPLE_CMD_BLOCK_WRITE, addr, MAPLE_DC_ADDR | MAPLE_ADDR_PORTB, VMU_BLOCK_SIZE, vmu_block);
+	Arena_Release(ARENA_VMU);
+	return; //Return to call point
+}
+
+//Decode a frame of an asset and put it on the screen
+void VMU_Show(const uint8_t *asset, const uint16_t *index, uint8_t frame, uint8_t addr){
+	VMU_Decode(asset, index, frame);
+	VMU_Write(addr);
+	return; //Return to call point
+}
+
+/******************** Interrupt Service Routines *********/
@@ -0,0 +1,36 @@
+// Generated by lcd_asset from 8 frame(s): 426 bytes (1536 raw)
+// lcd_asset --name vmu_banner --wipe 6 --out ../AnimatorDreamcast2.4GHz/VMUBanner.h assets/swallowtail.pbm assets/boosto.pbm
+#define VMU_BANNER_FRAMES 8
+
+const uint8_t vmu_banner[410] PROGMEM = {
+	0x00, 0x85, 0x00, 0x00, 0x1E, 0x83, 0x00, 0x00, 0x13, 0x83, 0x00, 0x01, 0x09, 0x80, 0x82, 0x00,
+	0x01, 0x05, 0xFC, 0x82, 0x00, 0x01, 0x06, 0x02, 0x82, 0x00, 0x02, 0x05, 0x01, 0x38, 0x81, 0x00,
+	0x02, 0x05, 0x34, 0xE8, 0x81, 0x00, 0x02, 0x05, 0x12, 0x68, 0x81, 0x00, 0x02, 0x05, 0x09, 0x2C,
+	0x81, 0x00, 0x02, 0x05, 0x08, 0xB4, 0x81, 0x00, 0x02, 0x05, 0x24, 0xB5, 0x81, 0x00, 0x02, 0x02,
+	0xA2, 0xBD, 0x81, 0x00, 0x03, 0x02, 0xFF, 0xE6, 0x40, 0x80, 0x00, 0x03, 0x02, 0x80, 0x7B, 0x50,
+	0x80, 0x00, 0x03, 0x02, 0x80, 0x8D, 0x90, 0x80, 0x00, 0x03, 0x02, 0xBF, 0x1A, 0xA0, 0x80, 0x00,
+	0x03, 0x05, 0x00, 0x25, 0x40, 0x80, 0x00, 0x03, 0x05, 0x00, 0x46, 0xE0, 0x80, 0x00, 0x03, 0x05,
+	0x3F, 0x89, 0xA0, 0x80, 0x00, 0x03, 0x0A, 0x01, 0x19, 0xF0, 0x80, 0x00, 0x03, 0x0A, 0x02, 0x29,
+	0xA8, 0x80, 0x00, 0x03, 0x0A, 0x04, 0x69, 0x28, 0x80, 0x00, 0x03, 0x0A, 0xF8, 0xA9, 0x14, 0x80,
+	0x00, 0x03, 0x0A, 0x09, 0x2A, 0x14, 0x80, 0x00, 0x03, 0x0A, 0x12, 0x2A, 0x10, 0x80, 0x00, 0x03,
+	0x0A, 0x24, 0x2A, 0x10, 0x80, 0x00, 0x02, 0x0A, 0xC8, 0x2C, 0x81, 0x00, 0x02, 0x0A, 0x10, 0x2C,
+	0x81, 0x00, 0x02, 0x0B, 0xF0, 0x2C, 0x81, 0x00, 0x02, 0x0F, 0xE0, 0x18, 0x86, 0x00, 0x01, 0x85,
+	0x00, 0x00, 0x1E, 0x83, 0x00, 0x01, 0x13, 0x01, 0x82, 0x00, 0x02, 0x09, 0x80, 0xC0, 0xFF, 0x00,
+	0xA7, 0x00, 0x01, 0x97, 0x00, 0x02, 0x05, 0xFC, 0x60, 0x81, 0x00, 0x02, 0x06, 0x02, 0xF8, 0x81,
+	0x00, 0x02, 0x05, 0x00, 0xC4, 0x81, 0x00, 0x02, 0x05, 0x32, 0xD6, 0x81, 0x00, 0x02, 0x05, 0x12,
+	0x16, 0xFF, 0x00, 0x89, 0x00, 0x01, 0xB5, 0x00, 0x02, 0x05, 0x08, 0xD2, 0x81, 0x00, 0x02, 0x05,
+	0x0B, 0x72, 0x81, 0x00, 0x02, 0x05, 0x25, 0x36, 0x81, 0x00, 0x03, 0x02, 0xA3, 0x3C, 0x80, 0xF1,
+	0x00, 0x01, 0xCD, 0x00, 0x03, 0x02, 0xFE, 0xE7, 0x80, 0x80, 0x00, 0x03, 0x02, 0x81, 0xFA, 0x90,
+	0x80, 0x00, 0x03, 0x02, 0x81, 0x02, 0x70, 0x80, 0x00, 0x03, 0x02, 0xBE, 0xDD, 0x40, 0x80, 0x00,
+	0x03, 0x05, 0x00, 0xA6, 0xA0, 0xD3, 0x00, 0x01, 0xEB, 0x00, 0x02, 0x05, 0x00, 0x07, 0x81, 0x00,
+	0x03, 0x05, 0x3F, 0x8A, 0x40, 0x80, 0x00, 0x03, 0x0A, 0x01, 0x16, 0x10, 0x80, 0x00, 0x03, 0x0A,
+	0x02, 0x26, 0x48, 0xBB, 0x00, 0x01, 0xFF, 0x00, 0x82, 0x00, 0x03, 0x0A, 0x04, 0x66, 0xC8, 0x80,
+	0x00, 0x03, 0x0A, 0xF8, 0xAA, 0xF4, 0x80, 0x00, 0x03, 0x0A, 0x09, 0x2B, 0xF4, 0x80, 0x00, 0x03,
+	0x0A, 0x12, 0x2B, 0xD0, 0x80, 0x00, 0x03, 0x0A, 0x24, 0x2B, 0xD0, 0x9D, 0x00, 0x01, 0xFF, 0x00,
+	0xA0, 0x00, 0x02, 0x0A, 0xC8, 0x2F, 0x81, 0x00, 0x02, 0x0A, 0x10, 0x22, 0x81, 0x00, 0x02, 0x0B,
+	0xF0, 0x24, 0x81, 0x00, 0x02, 0x0F, 0xE0, 0x18, 0x86, 0x00
+};
+
+const uint16_t vmu_banner_index[VMU_BANNER_FRAMES] PROGMEM = {
+	0, 190, 210, 245, 273, 311, 341, 381
+};
@@ -35,6 +35,11 @@
 #define F_CPU 16000000UL //Set clock speed to 16MHz (External 16MHz @ 3.3V is overclocking the AVR according to the datasheet, should be fine)
 #endif
 
+#define PAD_DEADLINE_MS 4 //Longest the poll task may be kept waiting (half a poll period)
+#define RADIO_DEADLINE_MS 10 //Longest the radio task may be kept waiting (the nRF is still retrying by itself)
+#define STATS_MS 5000 //Time between two counter reports (and the window the scheduler counters cover)
+#undef STATS_REPORT //Send the scheduler and Maple error counters out of PC3 for Tools/maple_dump (each report keeps the poll task waiting about 10ms)
+
 #define BIT_SET(byte, bit) (byte & (1<<bit))
 
 /******************** Includes ***************************/
@@ -50,11 +55,132 @@
 
 
 /******************* Local Includes **********************/
+#include "Battery.h"
 #include "Dreamcast.h"
 #include "nRF24L01.h"
+#include "Snapshot.h"
+#include "Scheduler.h"
+#include "Stack.h"
+
+//Newest controller state handed from the poll task to the radio task
+static Snapshot pad_snapshot;
+
+//Buffer for transmitting data
+static uint8_t tx_buffer[DREAMCAST_PAYLOAD_SIZE];
+//Buffer for the vibration settings coming back in the acknowledgments
+static uint8_t ack_buffer[RUMBLE_SIZE];
+//Controller status as sampled by the poll task and as picked up by the radio task
+static ControllerStatus controller;
+static ControllerStatus sample;
+//Set while a packet is on the air
+static uint8_t radio_busy = 0;
 
 /******************** Functions **************************/
 
+//Poll task: get the current button status and publish it (Dreamcast_Read gives the slot back instead of waiting on the bus)
+static void padTask(void){
+	if(Dreamcast_Read(&sample)){
+		Snapshot_Publish(&pad_snapshot, &sample, sizeof(sample));
+	}
+}
+
+//Radio task: collect the outcome of the packet on the air, then put the freshest complete sample on the air
+static void radioTask(void){
+	if(radio_busy){
+		//Check that the transmission was successful (If MAX_RT is 1 then the transmission failed)
+		uint8_t status = nRF24L01_TxStatus();
+		if(!status){
+			return; //Still on the air
+		}
+		//Retransmissions it took (ARC_CNT) must be read before the reset clears it
+		uint8_t retries = nRF24L01_ReadRegister(OBSERVE_TX) & 0x0F;
+		if((status & (1<<MAX_RT)) != 0){
+			PORTB |= (1<<PB0);
+			//Reset the nRF
+			nRF24L01_Reset();
+			PORTB &= ~(1<<PB0);
+		}
+		else{
+			//A vibration setting piggy-backed on the acknowledgment goes to the Puru-Puru pack between two polls
+			if(nRF24L01_ReadAckPayload(ack_buffer, sizeof(ack_buffer)) == RUMBLE_SIZE){
+				Dreamcast_Rumble(ack_buffer);
+			}
+			nRF24L01_ClearStatus(1<<TX_DS);
+		}
+		//Link quality for the VMS status screen, updated once per measurement window
+		if(HUD_Packet(retries, (status & (1<<MAX_RT)) != 0)){
+			HUD_Update(nRF24L01_ReadRegister(RF_CH), Battery_Millivolts());
+		}
+		//The bus is idle until the next poll: redraw the status screen now if it changed
+		Dreamcast_HUD_Write();
+		radio_busy = 0;
+	}
+	if(Snapshot_Take(&pad_snapshot, &controller, sizeof(controller))){
+		//If the A button is non-zero
+		if(BIT_SET(controller.buttons, DC_A)){
+			PORTB |= (1<<PB0);
+		}
+		else if(BIT_SET(controller.buttons, DC_B)){
+			PORTB &= ~(1<<PB0);
+		}
+		
+		//Put controller data into the tx_buffer to be transmitted (packed by the driver of the connected device)
+		Dreamcast_Pack(&controller, tx_buffer);
+	
+		//Start transmitting the controller data, the outcome is picked up on a later pass
+		nRF24L01_StartTransmit(tx_buffer, sizeof(tx_buffer));
+		radio_busy = 1;
+	}
+}
+
+#ifdef STATS_REPORT
+//Send a 16 bit counter, little endian
+static void statsWord(uint16_t value){
+	Serial_FrameByte(value & 0xFF);
+	Serial_FrameByte(value >> 8);
+}
+
+//Report task: send the scheduler counters of every task, the SRAM figures and the Maple error counters, then
+//start a new scheduler window. Runs between the other tasks, so the Maple bus is idle while the bits are bit-banged
+static void statsTask(void){
+	const DreamcastErrors *errors = Dreamcast_Errors();
+	uint8_t tasks = Scheduler_Count();
+	uint8_t i;
+	
+	//The scan walks all the free SRAM, it is only worth doing when the result goes out
+	Stack_Scan();
+	Serial_FrameBegin(SERIAL_TYPE_STATS, 3 + tasks * 10 + 3 * 2 + (6 + RECONNECT_BINS) * 2);
+	statsWord(TIMER_TICKS_PER_MS); //Lets the host scale the runtimes at any F_CPU
+	Serial_FrameByte(tasks);
+	for(i=0; i<tasks; i++){
+		const SchedulerTask *task = Scheduler_Stats(i);
+		statsWord(task->runs);
+		statsWord(task->misses);
+		statsWord(task->runtime_max);
+		statsWord(task->runtime_total & 0xFFFF);
+		statsWord(task->runtime_total >> 16);
+	}
+	statsWord(Stack_HighWater()); //Deepest the stack has been since reset
+	statsWord(Stack_Unused()); //Worst case free SRAM left
+#ifdef ARENA_CHECK
+	statsWord(Arena_Conflicts()); //Arena claims that overlapped another phase (should stay 0)
+#else
+	statsWord(0xFFFF); //Not counted
+#endif
+	statsWord(errors->timeouts);
+	statsWord(errors->lrc_errors);
+	statsWord(errors->overflows);
+	statsWord(errors->lrc_recovered);
+	statsWord(errors->resets);
+	statsWord(errors->reconnects);
+	for(i=0; i<RECONNECT_BINS; i++){
+		statsWord(errors->reconnect_hist[i]);
+	}
+	Serial_FrameEnd();
+	Scheduler_ResetStats();
+}
+#endif
+
 
 /********** Interrupt Service Routines *******************/
 
@@ -67,63 +193,40 @@ int main(void)
 	//nRF TX Address (5 bytes wide)
 	static uint8_t tx_address[5] = {0x12, 0x12, 0x12, 0x12, 0x12};
 	
-	//Buffer for transmitting data
-	static uint8_t tx_buffer[5];
+	//The controller state must fit in a snapshot slot
+	_Static_assert(sizeof(ControllerStatus) <= SNAPSHOT_SIZE, "ControllerStatus does not fit in a snapshot");
 	
 	//Initialize the debug output
 	DDRB |= (1<<PB0);
 	//Set the default values for outputs to zero and inputs to have pull-up resistors
 	PORTB |= (0<<PB0);
 	
-	//Get the current controller status
-	static ControllerStatus controller;
-	
+	//Start measuring the supply voltage for the VMS status screen
+	Battery_init();
 	//Initialize the Dreamcast Communications
 	Dreamcast_init();
 	//Initialize the nRF24L01 Communications as a transmitter
 	nRF24L01_init(TX, rx_address, tx_address);
+	//The receiver sends the vibration settings back in its auto-acknowledgments
+	nRF24L01_EnableAckPayload();
+	
+	//Both tasks run on every pass, they pace themselves and return as soon as they would have to wait
+	Scheduler_Add(padTask, 0, PAD_DEADLINE_MS);
+	Scheduler_Add(radioTask, 0, RADIO_DEADLINE_MS);
+#ifdef STATS_REPORT
+	//The counters go out of the serial port used by the capture dumps
+	Serial_init();
+	Scheduler_Add(statsTask, STATS_MS, STATS_MS);
+#endif
 	
 	//Set interrupts
 	sei();
 	
-	/* State machine loop */
+	/* Scheduler loop */
+	//Everything runs from this loop and no interrupt touches the SPI, so radio traffic can never land inside a Maple send or receive.
+	//The nRF sends packet N (and does its retries) on its own while the next GET_CONDITION is exchanged
 	while (1)
 	{
-		//Get the current button status
-		uint8_t success = Dreamcast_Read(&controller);
-		//If that read was successful
-		if(success){
-			//If that read was successful
-			//If the A button is non-zero
-			if(BIT_SET(controller.buttons, DC_A)){
-				PORTB |= (1<<PB0);
-			}
-			else if(BIT_SET(controller.buttons, DC_B)){
-				PORTB &= ~(1<<PB0);
-			}
-			
-			//Put controller data into the tx_buffer to be transmitted
-			tx_buffer[0] = ((uint16_t)controller.buttons >> 0) & 0xFF; //First byte of digital buttons
-			tx_buffer[1] = controller.ltrigger; //Left Analog Trigger
-			tx_buffer[2] = controller.rtrigger; //Right Analog Trigger
-			tx_buffer[3] = controller.joyx; //Left joystick for direction (X-coord)
-			tx_buffer[4] = controller.joyy; //Left joystick for direction (Y-coord)
-		
-			//Transmit the controller data
-			nRF24L01_Transmit(tx_buffer);
-		
-			//TODO improve buffer overflow issue
-			//Check that the transmission was successful (If MAX_RT is 1 then the transmission failed)
-			if((nRF24L01_ReadRegister(STATUS) & (1<<MAX_RT)) != 0){
-				PORTB |= (1<<PB0);
-				//Reset the nRF
-				nRF24L01_Reset();
-				PORTB &= ~(1<<PB0);
-			}
-			_delay_ms(10); //Might really mess up the MapleBus timing
-		}
+		Scheduler_Run();
 	}
 }
-
-
-
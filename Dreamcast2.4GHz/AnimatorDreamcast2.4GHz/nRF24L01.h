@@ -57,6 +57,8 @@
 #define RX_PW_P4    0x15
 #define RX_PW_P5    0x16
 #define FIFO_STATUS 0x17
+#define DYNPD       0x1C
+#define FEATURE     0x1D
 
 // Bit Mnemonics
 #define MASK_RX_DR  0x06
@@ -97,6 +99,9 @@
 #define TX_EMPTY    0x04
 #define RX_FULL     0x01
 #define RX_EMPTY    0x00
+#define DPL_P0      0x00
+#define EN_DPL      0x02
+#define EN_ACK_PAY  0x01
 
 // Instruction Mnemonics
 #define R_REGISTER    0x00
@@ -108,6 +113,9 @@
 #define FLUSH_RX      0xE2
 #define REUSE_TX_PL   0xE3
 #define NOP           0xFF
+#define ACTIVATE      0x50
+#define R_RX_PL_WID   0x60
+#define W_ACK_PAYLOAD 0xA8
 
 //Read and Write for the CE pin
 #define WRITE 1
@@ -151,14 +159,20 @@ void nRF24L01_Disable(){
 	return;
 }
 
+//The longest payload read back has to fit in the arena (Arena.h, included by Dreamcast.h)
+ARENA_FITS(32, "An nRF24L01 payload");
+
 //Writes the byte into the device or returns a byte array if reading
 uint8_t *nRF24L01_Transfer(uint8_t rwt, uint8_t reg, uint8_t *buffer, uint8_t length){
 	//If the user wants to write add the correct prefix to the register
 	if(rwt == WRITE){
 		reg = W_REGISTER + reg;
 	}
-	//Create the return buffer
-	static uint8_t returnBuff[32];
+	//Reads land in the arena (free between two Maple exchanges), the caller has to take them out before the next one
+	uint8_t *returnBuff = ARENA;
+	if(rwt == READ && reg != W_TX_PAYLOAD && length){
+		Arena_Claim(ARENA_RADIO);
+	}
 	
 	_delay_us(10); //Be sure the previous command has finished executing
 	nRF24L01_Enable();
@@ -266,23 +280,89 @@ void nRF24L01_init(uint8_t mode, uint8_t *RX_Address, uint8_t *TX_Address){
 	return; //Return to call point
 }
 
-//Transmit the buffer given (32 bytes wide)
-void nRF24L01_Transmit(uint8_t *buffer){
+//Clear the given interrupt flags in STATUS (write 1 to clear)
+void nRF24L01_ClearStatus(uint8_t flags){
+	uint8_t buffer[1];
+	
+	buffer[0] = flags;
+	nRF24L01_Transfer(WRITE, STATUS, buffer, 1);
+	return; //Return to call point
+}
+
+//Let the receiver answer with data in its auto-acknowledgments (needs dynamic payload length on pipe 0 at both ends)
+void nRF24L01_EnableAckPayload(){
+	uint8_t buffer[1];
+	
+	buffer[0] = (1<<EN_DPL) | (1<<EN_ACK_PAY);
+	nRF24L01_Transfer(WRITE, FEATURE, buffer, 1);
+	//The nRF24L01 (non plus) ignores FEATURE until it is unlocked with ACTIVATE 0x73
+	if(nRF24L01_ReadRegister(FEATURE) == 0x00){
+		//ACTIVATE takes 0x73 as its data byte, sent directly since a READ transfer would clock out NOP instead
+		_delay_us(10);
+		nRF24L01_Enable();
+		_delay_us(10);
+		SPI_Transfer(ACTIVATE);
+		_delay_us(10);
+		SPI_Transfer(0x73);
+		_delay_us(10);
+		nRF24L01_Disable();
+		buffer[0] = (1<<EN_DPL) | (1<<EN_ACK_PAY);
+		nRF24L01_Transfer(WRITE, FEATURE, buffer, 1);
+	}
+	buffer[0] = (1<<DPL_P0);
+	nRF24L01_Transfer(WRITE, DYNPD, buffer, 1);
+	return; //Return to call point
+}
+
+//Pick up the payload of an auto-acknowledgment if one came back. Returns its length (0 if there was none)
+uint8_t nRF24L01_ReadAckPayload(uint8_t *buffer, uint8_t max){
+	uint8_t width, i;
+	uint8_t *payload;
+	
+	if((nRF24L01_ReadRegister(STATUS) & (1<<RX_DR)) == 0){
+		return 0;
+	}
+	width = nRF24L01_ReadRegister(R_RX_PL_WID);
+	if(width > 32){
+		//Corrupt width, the datasheet says to flush the RX FIFO
+		nRF24L01_Transfer(READ, FLUSH_RX, buffer, 0);
+		width = 0;
+	}
+	else{
+		payload = nRF24L01_Transfer(READ, R_RX_PAYLOAD, buffer, width);
+		if(width > max){
+			width = max;
+		}
+		for(i=0; i<width; i++){
+			buffer[i] = payload[i];
+		}
+		Arena_Release(ARENA_RADIO);
+	}
+	//Clear RX_DR only, TX_DS and MAX_RT are handled by the transmitter
+	nRF24L01_ClearStatus(1<<RX_DR);
+	return width;
+}
+
+//Start sending the buffer and return right away, poll nRF24L01_TxStatus for the outcome
+void nRF24L01_StartTransmit(uint8_t *buffer, uint8_t length){
 	//Flush the current transmit buffer
 	nRF24L01_Transfer(READ, FLUSH_TX, buffer, 0);
 	//Sends the data in buffer to the nRF
-	nRF24L01_Transfer(READ, W_TX_PAYLOAD, buffer, 5); //User read operation since W_TX_PAYLOAD is on the highest byte level in thr nRF
-	
-	//Give 10ms after loading the nRF with payload before TX
-	_delay_ms(10);
-	//Pull CE high to transmit the data
+	nRF24L01_Transfer(READ, W_TX_PAYLOAD, buffer, length);
+	//A CE pulse of at least 10us starts the packet, the nRF does the retries on its own and then goes back to standby
 	PORT_nRF24L01 |= (1<<CE);
-	//Delay a bit for that data to go where it needs to
-	_delay_us(20);
-	//Stop transmitting
+	_delay_us(15);
 	PORT_nRF24L01 &= ~(1<<CE);
-	//Long delay before next operation
-	_delay_ms(10);
+	return; //Return to call point
+}
+
+//Outcome of the packet started by nRF24L01_StartTransmit: STATUS with TX_DS or MAX_RT set, 0 while it is still on the air
+uint8_t nRF24L01_TxStatus(){
+	uint8_t status = nRF24L01_ReadRegister(STATUS);
+	if((status & ((1<<TX_DS) | (1<<MAX_RT))) == 0){
+		return 0;
+	}
+	return status;
 }
 
 uint8_t *nRF24L01_Recieve(){
@@ -294,7 +374,7 @@ uint8_t *nRF24L01_Recieve(){
 	//Read out the received message
 	buffer = nRF24L01_Transfer(READ, R_RX_PAYLOAD, buffer, 5);
 	nRF24L01_Reset();
-	//return the received buffer
+	//return the received buffer (in the arena, valid until the next Maple exchange)
 	return buffer;
 }
 
@@ -1,5 +1,6 @@
-// Generated by generate_rxcode.sh
-// Number of samples: 640
+// Generated by generate_rxcode
+// 3 cycles per sample
+// Number of samples: 641
 "   in r16, %1\n   st z+, r16   \n" // sample 0 
 "   in r16, %1\n   st z+, r16   \n" // sample 1 
 "   in r16, %1\n   st z+, r16   \n" // sample 2 
@@ -640,4 +641,4 @@
 "   in r16, %1\n   st z+, r16   \n" // sample 637 
 "   in r16, %1\n   st z+, r16   \n" // sample 638 
 "   in r16, %1\n   st z+, r16   \n" // sample 639 
-"   in r16, %1\n   st z+, r16   \n" // sample 640 
\ No newline at end of file
+"   in r16, %1\n   st z+, r16   \n" // sample 640 
@@ -0,0 +1,12 @@
+// Generated by generate_rxcode
+// generate_rxcode --f-cpu 16000000 --rate 5333333 --samples 641 --format raw
+#ifndef RXCODE_H
+#define RXCODE_H
+
+#define MAPLE_RX_F_CPU	16000000UL	// clock the sampler was generated for
+#define MAPLE_RX_CYCLES	3	// CPU cycles per sample
+#define MAPLE_RX_SAMPLES	641
+#define MAPLE_RX_BYTES	641	// bytes written to maplebuf
+#define MAPLE_RX_PACKED	0
+
+#endif
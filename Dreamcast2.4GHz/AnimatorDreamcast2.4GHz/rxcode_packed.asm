@@ -0,0 +1,644 @@
+// Generated by generate_rxcode
+// Packed capture: two samples per byte (first sample in the upper nibble)
+// 4 cycles per sample, PD4 and PD5 must stay low while sampling
+// Number of samples: 1280
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 0-1 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 2-3 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 4-5 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 6-7 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 8-9 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 10-11 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 12-13 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 14-15 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 16-17 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 18-19 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 20-21 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 22-23 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 24-25 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 26-27 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 28-29 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 30-31 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 32-33 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 34-35 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 36-37 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 38-39 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 40-41 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 42-43 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 44-45 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 46-47 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 48-49 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 50-51 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 52-53 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 54-55 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 56-57 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 58-59 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 60-61 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 62-63 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 64-65 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 66-67 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 68-69 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 70-71 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 72-73 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 74-75 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 76-77 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 78-79 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 80-81 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 82-83 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 84-85 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 86-87 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 88-89 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 90-91 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 92-93 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 94-95 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 96-97 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 98-99 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 100-101 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 102-103 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 104-105 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 106-107 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 108-109 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 110-111 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 112-113 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 114-115 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 116-117 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 118-119 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 120-121 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 122-123 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 124-125 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 126-127 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 128-129 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 130-131 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 132-133 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 134-135 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 136-137 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 138-139 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 140-141 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 142-143 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 144-145 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 146-147 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 148-149 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 150-151 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 152-153 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 154-155 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 156-157 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 158-159 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 160-161 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 162-163 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 164-165 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 166-167 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 168-169 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 170-171 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 172-173 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 174-175 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 176-177 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 178-179 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 180-181 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 182-183 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 184-185 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 186-187 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 188-189 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 190-191 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 192-193 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 194-195 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 196-197 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 198-199 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 200-201 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 202-203 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 204-205 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 206-207 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 208-209 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 210-211 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 212-213 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 214-215 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 216-217 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 218-219 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 220-221 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 222-223 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 224-225 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 226-227 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 228-229 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 230-231 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 232-233 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 234-235 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 236-237 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 238-239 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 240-241 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 242-243 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 244-245 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 246-247 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 248-249 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 250-251 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 252-253 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 254-255 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 256-257 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 258-259 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 260-261 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 262-263 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 264-265 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 266-267 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 268-269 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 270-271 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 272-273 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 274-275 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 276-277 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 278-279 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 280-281 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 282-283 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 284-285 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 286-287 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 288-289 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 290-291 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 292-293 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 294-295 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 296-297 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 298-299 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 300-301 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 302-303 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 304-305 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 306-307 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 308-309 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 310-311 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 312-313 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 314-315 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 316-317 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 318-319 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 320-321 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 322-323 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 324-325 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 326-327 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 328-329 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 330-331 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 332-333 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 334-335 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 336-337 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 338-339 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 340-341 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 342-343 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 344-345 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 346-347 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 348-349 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 350-351 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 352-353 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 354-355 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 356-357 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 358-359 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 360-361 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 362-363 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 364-365 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 366-367 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 368-369 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 370-371 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 372-373 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 374-375 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 376-377 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 378-379 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 380-381 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 382-383 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 384-385 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 386-387 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 388-389 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 390-391 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 392-393 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 394-395 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 396-397 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 398-399 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 400-401 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 402-403 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 404-405 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 406-407 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 408-409 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 410-411 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 412-413 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 414-415 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 416-417 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 418-419 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 420-421 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 422-423 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 424-425 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 426-427 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 428-429 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 430-431 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 432-433 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 434-435 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 436-437 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 438-439 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 440-441 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 442-443 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 444-445 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 446-447 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 448-449 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 450-451 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 452-453 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 454-455 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 456-457 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 458-459 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 460-461 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 462-463 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 464-465 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 466-467 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 468-469 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 470-471 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 472-473 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 474-475 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 476-477 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 478-479 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 480-481 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 482-483 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 484-485 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 486-487 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 488-489 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 490-491 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 492-493 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 494-495 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 496-497 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 498-499 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 500-501 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 502-503 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 504-505 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 506-507 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 508-509 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 510-511 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 512-513 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 514-515 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 516-517 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 518-519 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 520-521 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 522-523 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 524-525 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 526-527 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 528-529 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 530-531 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 532-533 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 534-535 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 536-537 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 538-539 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 540-541 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 542-543 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 544-545 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 546-547 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 548-549 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 550-551 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 552-553 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 554-555 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 556-557 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 558-559 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 560-561 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 562-563 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 564-565 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 566-567 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 568-569 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 570-571 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 572-573 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 574-575 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 576-577 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 578-579 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 580-581 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 582-583 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 584-585 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 586-587 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 588-589 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 590-591 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 592-593 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 594-595 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 596-597 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 598-599 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 600-601 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 602-603 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 604-605 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 606-607 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 608-609 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 610-611 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 612-613 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 614-615 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 616-617 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 618-619 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 620-621 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 622-623 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 624-625 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 626-627 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 628-629 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 630-631 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 632-633 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 634-635 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 636-637 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 638-639 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 640-641 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 642-643 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 644-645 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 646-647 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 648-649 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 650-651 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 652-653 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 654-655 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 656-657 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 658-659 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 660-661 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 662-663 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 664-665 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 666-667 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 668-669 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 670-671 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 672-673 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 674-675 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 676-677 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 678-679 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 680-681 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 682-683 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 684-685 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 686-687 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 688-689 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 690-691 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 692-693 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 694-695 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 696-697 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 698-699 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 700-701 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 702-703 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 704-705 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 706-707 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 708-709 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 710-711 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 712-713 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 714-715 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 716-717 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 718-719 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 720-721 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 722-723 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 724-725 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 726-727 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 728-729 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 730-731 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 732-733 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 734-735 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 736-737 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 738-739 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 740-741 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 742-743 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 744-745 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 746-747 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 748-749 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 750-751 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 752-753 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 754-755 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 756-757 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 758-759 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 760-761 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 762-763 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 764-765 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 766-767 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 768-769 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 770-771 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 772-773 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 774-775 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 776-777 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 778-779 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 780-781 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 782-783 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 784-785 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 786-787 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 788-789 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 790-791 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 792-793 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 794-795 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 796-797 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 798-799 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 800-801 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 802-803 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 804-805 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 806-807 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 808-809 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 810-811 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 812-813 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 814-815 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 816-817 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 818-819 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 820-821 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 822-823 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 824-825 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 826-827 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 828-829 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 830-831 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 832-833 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 834-835 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 836-837 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 838-839 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 840-841 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 842-843 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 844-845 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 846-847 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 848-849 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 850-851 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 852-853 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 854-855 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 856-857 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 858-859 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 860-861 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 862-863 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 864-865 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 866-867 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 868-869 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 870-871 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 872-873 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 874-875 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 876-877 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 878-879 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 880-881 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 882-883 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 884-885 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 886-887 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 888-889 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 890-891 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 892-893 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 894-895 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 896-897 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 898-899 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 900-901 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 902-903 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 904-905 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 906-907 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 908-909 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 910-911 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 912-913 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 914-915 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 916-917 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 918-919 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 920-921 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 922-923 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 924-925 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 926-927 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 928-929 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 930-931 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 932-933 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 934-935 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 936-937 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 938-939 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 940-941 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 942-943 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 944-945 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 946-947 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 948-949 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 950-951 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 952-953 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 954-955 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 956-957 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 958-959 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 960-961 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 962-963 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 964-965 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 966-967 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 968-969 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 970-971 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 972-973 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 974-975 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 976-977 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 978-979 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 980-981 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 982-983 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 984-985 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 986-987 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 988-989 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 990-991 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 992-993 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 994-995 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 996-997 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 998-999 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1000-1001 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1002-1003 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1004-1005 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1006-1007 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1008-1009 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1010-1011 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1012-1013 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1014-1015 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1016-1017 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1018-1019 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1020-1021 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1022-1023 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1024-1025 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1026-1027 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1028-1029 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1030-1031 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1032-1033 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1034-1035 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1036-1037 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1038-1039 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1040-1041 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1042-1043 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1044-1045 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1046-1047 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1048-1049 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1050-1051 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1052-1053 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1054-1055 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1056-1057 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1058-1059 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1060-1061 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1062-1063 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1064-1065 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1066-1067 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1068-1069 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1070-1071 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1072-1073 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1074-1075 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1076-1077 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1078-1079 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1080-1081 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1082-1083 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1084-1085 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1086-1087 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1088-1089 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1090-1091 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1092-1093 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1094-1095 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1096-1097 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1098-1099 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1100-1101 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1102-1103 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1104-1105 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1106-1107 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1108-1109 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1110-1111 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1112-1113 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1114-1115 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1116-1117 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1118-1119 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1120-1121 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1122-1123 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1124-1125 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1126-1127 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1128-1129 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1130-1131 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1132-1133 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1134-1135 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1136-1137 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1138-1139 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1140-1141 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1142-1143 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1144-1145 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1146-1147 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1148-1149 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1150-1151 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1152-1153 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1154-1155 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1156-1157 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1158-1159 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1160-1161 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1162-1163 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1164-1165 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1166-1167 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1168-1169 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1170-1171 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1172-1173 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1174-1175 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1176-1177 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1178-1179 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1180-1181 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1182-1183 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1184-1185 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1186-1187 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1188-1189 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1190-1191 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1192-1193 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1194-1195 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1196-1197 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1198-1199 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1200-1201 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1202-1203 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1204-1205 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1206-1207 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1208-1209 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1210-1211 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1212-1213 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1214-1215 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1216-1217 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1218-1219 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1220-1221 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1222-1223 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1224-1225 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1226-1227 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1228-1229 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1230-1231 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1232-1233 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1234-1235 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1236-1237 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1238-1239 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1240-1241 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1242-1243 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1244-1245 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1246-1247 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1248-1249 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1250-1251 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1252-1253 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1254-1255 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1256-1257 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1258-1259 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1260-1261 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1262-1263 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1264-1265 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1266-1267 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1268-1269 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1270-1271 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1272-1273 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1274-1275 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1276-1277 
+"   in r16, %1\n   swap r16\n   nop\n   nop\n   in r17, %1\n   or r16, r17\n   st z+, r16   \n" // samples 1278-1279 
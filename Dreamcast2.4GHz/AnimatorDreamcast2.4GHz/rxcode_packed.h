@@ -0,0 +1,12 @@
+// Generated by generate_rxcode
+// generate_rxcode --f-cpu 16000000 --rate 4000000 --samples 1280 --format packed
+#ifndef RXCODE_PACKED_H
+#define RXCODE_PACKED_H
+
+#define MAPLE_RX_F_CPU	16000000UL	// clock the sampler was generated for
+#define MAPLE_RX_CYCLES	4	// CPU cycles per sample
+#define MAPLE_RX_SAMPLES	1280
+#define MAPLE_RX_BYTES	640	// bytes written to maplebuf
+#define MAPLE_RX_PACKED	1
+
+#endif
@@ -0,0 +1,230 @@
+//-----------------------------------------------------------------------------
+//
+//  generate_rxcode.cpp
+//
+//  Swallowtail Maple Receive Code Generator
+//  Host tool: generates the unrolled Maple bus sampler
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build:
+//    g++ -O2 -o generate_rxcode generate_rxcode.cpp
+//
+//  Usage:
+//    generate_rxcode [--f-cpu HZ] [--rate HZ] [--samples N] [--format raw|packed] [--out FILE.asm]
+//
+//  Writes the unrolled in/st sequence included by maple_receiveFrame and a
+//  header next to it (FILE.h) with the sample count, capture size and clock
+//  it was generated for. MapleBus.h refuses to build if that clock doesn't
+//  match F_CPU, so a new part or crystal only needs the tool to be re-run.
+//
+//  Defaults regenerate the shipped rxcode.asm (16MHz, 3 cycles per sample,
+//  641 raw samples). The packed format needs an even sample count and at
+//  least 4 cycles per sample (in, or, st take 4 between the second sample
+//  of a byte and the first of the next); its defaults regenerate
+//  rxcode_packed.asm (4 cycles, 1280 samples).
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/******************** Macros *****************************/
+
+#define RX_MIN_CYCLES 3 //in (1) + st (2), the fastest the sampler can go
+#define RX_MIN_PACKED_CYCLES 4 //in (1) + or (1) + st (2) between two packed bytes
+
+/******************* Globals *****************************/
+
+struct Options {
+	unsigned long f_cpu = 16000000UL;
+	unsigned long rate = 0; //0: as fast as possible
+	unsigned samples = 641;
+	bool packed = false;
+	std::string out = "rxcode.asm";
+};
+
+/******************** Functions **************************/
+
+static void Usage(const char *name){
+	fprintf(stderr, "usage: %s [--f-cpu HZ] [--rate HZ] [--samples N] [--format raw|packed] [--out FILE.asm]\n", name);
+	exit(2);
+}
+
+//Parse the command line, exit with a message on anything unexpected
+static Options Options_Parse(int argc, char **argv){
+	Options opt;
+	bool samples_set = false;
+	for(int i=1; i<argc; i++){
+		std::string arg = argv[i];
+		if(i+1 >= argc){
+			Usage(argv[0]);
+		}
+		const char *val = argv[++i];
+		if(arg == "--f-cpu"){
+			opt.f_cpu = strtoul(val, NULL, 0);
+		}
+		else if(arg == "--rate"){
+			opt.rate = strtoul(val, NULL, 0);
+		}
+		else if(arg == "--samples"){
+			opt.samples = strtoul(val, NULL, 0);
+			samples_set = true;
+		}
+		else if(arg == "--format"){
+			if(!strcmp(val, "packed")){
+				opt.packed = true;
+			}
+			else if(strcmp(val, "raw")){
+				Usage(argv[0]);
+			}
+		}
+		else if(arg == "--out"){
+			opt.out = val;
+		}
+		else{
+			Usage(argv[0]);
+		}
+	}
+	//Packed captures fill the same 640 bytes with twice the samples
+	if(opt.packed && !samples_set){
+		opt.samples = 1280;
+	}
+	return opt;
+}
+
+//Append n cycles of padding
+static std::string Pad(unsigned n){
+	std::string s;
+	while(n--){
+		s += "   nop\\n";
+	}
+	return s;
+}
+
+//Header name for an output file: rxcode.asm -> rxcode.h
+static std::string Header_Path(const std::string &asm_path){
+	size_t dot = asm_path.rfind('.');
+	size_t slash = asm_path.find_last_of("/\\");
+	if(dot == std::string::npos || (slash != std::string::npos && dot < slash)){
+		return asm_path + ".h";
+	}
+	return asm_path.substr(0, dot) + ".h";
+}
+
+//Include guard for a header path: dir/rxcode_packed.h -> RXCODE_PACKED_H
+static std::string Header_Guard(const std::string &path){
+	size_t slash = path.find_last_of("/\\");
+	std::string base = slash == std::string::npos ? path : path.substr(slash + 1);
+	std::string guard;
+	for(char c : base){
+		guard += isalnum((unsigned char)c) ? toupper((unsigned char)c) : '_';
+	}
+	return guard;
+}
+
+int main(int argc, char **argv){
+	Options opt = Options_Parse(argc, argv);
+
+	//Cycles between two samples, the same for every pair of samples
+	unsigned min_cycles = opt.packed ? RX_MIN_PACKED_CYCLES : RX_MIN_CYCLES;
+	unsigned cycles = min_cycles;
+	if(opt.rate){
+		cycles = (unsigned)((opt.f_cpu + opt.rate / 2) / opt.rate);
+	}
+	if(cycles < min_cycles){
+		fprintf(stderr, "%lu Hz needs %u cycles per sample at %lu Hz, the sampler needs at least %u\n",
+			opt.rate, cycles, opt.f_cpu, min_cycles);
+		return 1;
+	}
+	if(opt.samples == 0 || (opt.packed && (opt.samples & 1))){
+		fprintf(stderr, "invalid sample count %u\n", opt.samples);
+		return 1;
+	}
+	unsigned bytes = opt.packed ? opt.samples / 2 : opt.samples;
+
+	FILE *fp = fopen(opt.out.c_str(), "w");
+	if(!fp){
+		perror(opt.out.c_str());
+		return 1;
+	}
+	fprintf(fp, "// Generated by generate_rxcode\n");
+	if(opt.packed){
+		fprintf(fp, "// Packed capture: two samples per byte (first sample in the upper nibble)\n");
+		fprintf(fp, "// %u cycles per sample, PD4 and PD5 must stay low while sampling\n", cycles);
+	}
+	else{
+		fprintf(fp, "// %u cycles per sample\n", cycles);
+	}
+	fprintf(fp, "// Number of samples: %u\n", opt.samples);
+	if(opt.packed){
+		//in, swap, pad, in, or, st, pad: each in lands 'cycles' after the previous one
+		std::string line = "   in r16, %1\\n   swap r16\\n" + Pad(cycles - 2)
+			+ "   in r17, %1\\n   or r16, r17\\n   st z+, r16   \\n" + Pad(cycles - 4);
+		for(unsigned i=0; i<opt.samples; i+=2){
+			fprintf(fp, "\"%s\" // samples %u-%u \n", line.c_str(), i, i+1);
+		}
+	}
+	else{
+		std::string line = "   in r16, %1\\n   st z+, r16   \\n" + Pad(cycles - 3);
+		for(unsigned i=0; i<opt.samples; i++){
+			fprintf(fp, "\"%s\" // sample %u \n", line.c_str(), i);
+		}
+	}
+	fclose(fp);
+
+	std::string hpath = Header_Path(opt.out);
+	std::string guard = Header_Guard(hpath);
+	fp = fopen(hpath.c_str(), "w");
+	if(!fp){
+		perror(hpath.c_str());
+		return 1;
+	}
+	fprintf(fp, "// Generated by generate_rxcode\n");
+	fprintf(fp, "// generate_rxcode --f-cpu %lu --rate %lu --samples %u --format %s\n",
+		opt.f_cpu, opt.f_cpu / cycles, opt.samples, opt.packed ? "packed" : "raw");
+	fprintf(fp, "#ifndef %s\n", guard.c_str());
+	fprintf(fp, "#define %s\n", guard.c_str());
+	fprintf(fp, "\n");
+	fprintf(fp, "#define MAPLE_RX_F_CPU\t%luUL\t// clock the sampler was generated for\n", opt.f_cpu);
+	fprintf(fp, "#define MAPLE_RX_CYCLES\t%u\t// CPU cycles per sample\n", cycles);
+	fprintf(fp, "#define MAPLE_RX_SAMPLES\t%u\n", opt.samples);
+	fprintf(fp, "#define MAPLE_RX_BYTES\t%u\t// bytes written to maplebuf\n", bytes);
+	fprintf(fp, "#define MAPLE_RX_PACKED\t%d\n", opt.packed ? 1 : 0);
+	fprintf(fp, "\n");
+	fprintf(fp, "#endif\n");
+	fclose(fp);
+
+	printf("%s: %u samples, %u cycles per sample (%.3f MHz), %.1f us window, %u bytes\n",
+		opt.out.c_str(), opt.samples, cycles, opt.f_cpu / (double)cycles / 1e6,
+		opt.samples * cycles * 1e6 / opt.f_cpu, bytes);
+	return 0;
+}
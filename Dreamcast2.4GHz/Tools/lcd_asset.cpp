@@ -0,0 +1,317 @@
+//-----------------------------------------------------------------------------
+//
+//  lcd_asset.cpp
+//
+//  Swallowtail VMU LCD Asset Converter
+//  Host tool: compresses 48x32 images for the VMU screen
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build:
+//    g++ -O2 -o lcd_asset lcd_asset.cpp
+//
+//  Usage:
+//    lcd_asset [--name NAME] [--key-interval N] [--wipe STEPS] [--out FILE.h] frame0.pbm [frame1.pbm ...]
+//
+//  Reads 48x32 PBM images (plain P1 or raw P4, black = pixel on) and writes
+//  a header for VMU.h holding every frame compressed in flash:
+//
+//    NAME_FRAMES          number of frames
+//    NAME[]               the compressed frames back to back
+//    NAME_index[]         offset of each frame in NAME[]
+//
+//  Each frame starts with a type byte: VMU_KEY frames are the whole bitmap,
+//  VMU_DELTA frames are XORed with the frame before so only the pixels that
+//  changed cost anything. Both are run length encoded:
+//
+//    0x00-0x7F  n+1 literal bytes follow
+//    0x80-0xFF  the next byte repeated n-0x80+2 times
+//
+//  A key frame is forced every --key-interval frames (default 8) so the
+//  device never replays a long chain of deltas to reach a frame. --wipe
+//  inserts STEPS frames between each image and the next, uncovering the
+//  next image from the top down.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/******************** Macros *****************************/
+
+#define LCD_WIDTH 48
+#define LCD_HEIGHT 32
+#define LCD_BYTES (LCD_WIDTH * LCD_HEIGHT / 8) //192, one bit per pixel, MSB is the leftmost pixel
+
+#define VMU_KEY 0x00 //Must match VMU.h
+#define VMU_DELTA 0x01
+
+#define RLE_MAX_LITERAL 128
+#define RLE_MAX_RUN 129
+
+/******************* Globals *****************************/
+
+typedef std::vector<unsigned char> Bytes;
+
+/******************** Functions **************************/
+
+//Next token of a PBM header, skipping whitespace and comments
+static std::string PBM_Token(FILE *fp){
+	std::string tok;
+	int c;
+	while((c = fgetc(fp)) != EOF){
+		if(c == '#'){
+			while((c = fgetc(fp)) != EOF && c != '\n');
+			continue;
+		}
+		if(isspace(c)){
+			if(!tok.empty()){
+				break;
+			}
+			continue;
+		}
+		tok += (char)c;
+	}
+	return tok;
+}
+
+//Load a 48x32 PBM into the LCD bit layout
+static bool PBM_Load(const char *path, Bytes &bitmap){
+	FILE *fp = fopen(path, "rb");
+	if(!fp){
+		perror(path);
+		return false;
+	}
+	std::string magic = PBM_Token(fp);
+	int w = atoi(PBM_Token(fp).c_str());
+	int h = atoi(PBM_Token(fp).c_str());
+	if((magic != "P1" && magic != "P4") || w != LCD_WIDTH || h != LCD_HEIGHT){
+		fprintf(stderr, "%s: expected a %dx%d P1 or P4 PBM\n", path, LCD_WIDTH, LCD_HEIGHT);
+		fclose(fp);
+		return false;
+	}
+	bitmap.assign(LCD_BYTES, 0);
+	bool ok = true;
+	if(magic == "P4"){
+		ok = fread(bitmap.data(), 1, LCD_BYTES, fp) == LCD_BYTES;
+	}
+	else{
+		for(int i=0; i<LCD_WIDTH * LCD_HEIGHT && ok; i++){
+			int c;
+			while((c = fgetc(fp)) != EOF && c != '0' && c != '1');
+			if(c == EOF){
+				ok = false;
+			}
+			else if(c == '1'){
+				bitmap[i / 8] |= 0x80 >> (i % 8);
+			}
+		}
+	}
+	fclose(fp);
+	if(!ok){
+		fprintf(stderr, "%s: truncated image\n", path);
+	}
+	return ok;
+}
+
+//Run length encode one bitmap (runs of 2 or more identical bytes)
+static void RLE_Encode(const Bytes &in, Bytes &out){
+	size_t i = 0;
+	while(i < in.size()){
+		size_t run = 1;
+		while(i + run < in.size() && in[i + run] == in[i] && run < RLE_MAX_RUN){
+			run++;
+		}
+		if(run >= 2){
+			out.push_back(0x80 + (run - 2));
+			out.push_back(in[i]);
+			i += run;
+			continue;
+		}
+		//Literals up to the next run of 2 or more
+		size_t start = i;
+		while(i < in.size() && i - start < RLE_MAX_LITERAL){
+			if(i + 1 < in.size() && in[i + 1] == in[i]){
+				break;
+			}
+			i++;
+		}
+		out.push_back(i - start - 1);
+		out.insert(out.end(), in.begin() + start, in.begin() + i);
+	}
+}
+
+//Same decoder as VMU_Decode, used to check the output
+static size_t RLE_Decode(const Bytes &in, size_t pos, Bytes &fb, bool delta){
+	size_t o = 0;
+	while(o < LCD_BYTES){
+		unsigned char c = in[pos++];
+		if(c & 0x80){
+			unsigned n = c - 0x80 + 2;
+			unsigned char v = in[pos++];
+			while(n--){
+				fb[o] = delta ? fb[o] ^ v : v;
+				o++;
+			}
+		}
+		else{
+			unsigned n = c + 1;
+			while(n--){
+				fb[o] = delta ? fb[o] ^ in[pos] : in[pos];
+				o++;
+				pos++;
+			}
+		}
+	}
+	return pos;
+}
+
+int main(int argc, char **argv){
+	std::string name = "vmu_asset";
+	std::string out = "VMUAsset.h";
+	int key_interval = 8;
+	int wipe = 0;
+	std::vector<Bytes> images, frames;
+
+	for(int i=1; i<argc; i++){
+		if(!strcmp(argv[i], "--name") && i+1 < argc){
+			name = argv[++i];
+		}
+		else if(!strcmp(argv[i], "--out") && i+1 < argc){
+			out = argv[++i];
+		}
+		else if(!strcmp(argv[i], "--key-interval") && i+1 < argc){
+			key_interval = atoi(argv[++i]);
+		}
+		else if(!strcmp(argv[i], "--wipe") && i+1 < argc){
+			wipe = atoi(argv[++i]);
+		}
+		else if(argv[i][0] == '-'){
+			fprintf(stderr, "usage: %s [--name NAME] [--key-interval N] [--wipe STEPS] [--out FILE.h] frame0.pbm [frame1.pbm ...]\n", argv[0]);
+			return 2;
+		}
+		else{
+			Bytes bitmap;
+			if(!PBM_Load(argv[i], bitmap)){
+				return 1;
+			}
+			images.push_back(bitmap);
+		}
+	}
+
+	//Transition frames: rows above the edge come from the next image
+	for(size_t n=0; n<images.size(); n++){
+		if(n){
+			for(int step=1; step<=wipe; step++){
+				Bytes f = images[n-1];
+				int rows = step * LCD_HEIGHT / (wipe + 1);
+				memcpy(f.data(), images[n].data(), rows * LCD_WIDTH / 8);
+				frames.push_back(f);
+			}
+		}
+		frames.push_back(images[n]);
+	}
+	if(frames.empty() || frames.size() > 255 || key_interval < 1){
+		fprintf(stderr, "need 1 to 255 frames and a key interval of at least 1\n");
+		return 2;
+	}
+
+	//Compress: pick the smaller of key and delta unless a key frame is due
+	Bytes data;
+	std::vector<size_t> index;
+	for(size_t f=0; f<frames.size(); f++){
+		Bytes key, delta;
+		RLE_Encode(frames[f], key);
+		bool use_delta = false;
+		if(f % key_interval){
+			Bytes x(LCD_BYTES);
+			for(int i=0; i<LCD_BYTES; i++){
+				x[i] = frames[f][i] ^ frames[f-1][i];
+			}
+			RLE_Encode(x, delta);
+			use_delta = delta.size() < key.size();
+		}
+		index.push_back(data.size());
+		data.push_back(use_delta ? VMU_DELTA : VMU_KEY);
+		const Bytes &body = use_delta ? delta : key;
+		data.insert(data.end(), body.begin(), body.end());
+	}
+	if(data.size() > 0xFFFF){
+		fprintf(stderr, "asset too large\n");
+		return 1;
+	}
+
+	//Play it back the way the device does and make sure every frame comes out right
+	Bytes fb(LCD_BYTES, 0);
+	for(size_t f=0; f<frames.size(); f++){
+		size_t pos = index[f];
+		bool delta = data[pos++] == VMU_DELTA;
+		RLE_Decode(data, pos, fb, delta);
+		if(fb != frames[f]){
+			fprintf(stderr, "internal error: frame %u does not decode back\n", (unsigned)f);
+			return 1;
+		}
+	}
+
+	FILE *fp = fopen(out.c_str(), "w");
+	if(!fp){
+		perror(out.c_str());
+		return 1;
+	}
+	std::string upper;
+	for(char c : name){
+		upper += toupper((unsigned char)c);
+	}
+	fprintf(fp, "// Generated by lcd_asset from %u frame(s): %u bytes (%u raw)\n",
+		(unsigned)frames.size(), (unsigned)(data.size() + 2 * index.size()), (unsigned)(frames.size() * LCD_BYTES));
+	fprintf(fp, "// lcd_asset");
+	for(int i=1; i<argc; i++){
+		fprintf(fp, " %s", argv[i]);
+	}
+	fprintf(fp, "\n");
+	fprintf(fp, "#define %s_FRAMES %u\n\n", upper.c_str(), (unsigned)frames.size());
+	fprintf(fp, "const uint8_t %s[%u] PROGMEM = {", name.c_str(), (unsigned)data.size());
+	for(size_t i=0; i<data.size(); i++){
+		fprintf(fp, "%s0x%02X%s", (i % 16) ? " " : "\n\t", data[i], i + 1 < data.size() ? "," : "");
+	}
+	fprintf(fp, "\n};\n\n");
+	fprintf(fp, "const uint16_t %s_index[%s_FRAMES] PROGMEM = {", name.c_str(), upper.c_str());
+	for(size_t i=0; i<index.size(); i++){
+		fprintf(fp, "%s%u%s", (i % 8) ? " " : "\n\t", (unsigned)index[i], i + 1 < index.size() ? "," : "");
+	}
+	fprintf(fp, "\n};\n");
+	fclose(fp);
+
+	printf("%s: %u frames, %u bytes of flash instead of %u\n", out.c_str(), (unsigned)frames.size(),
+		(unsigned)(data.size() + 2 * index.size()), (unsigned)(frames.size() * LCD_BYTES));
+	return 0;
+}
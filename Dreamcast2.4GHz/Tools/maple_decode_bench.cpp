@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------------
+//
+//  maple_decode_bench.cpp
+//
+//  Swallowtail Maple Decoder Benchmark
+//  Host tool: checks and times the Maple bus reply decoders
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build (add -DMAPLE_CAPTURE_PACKED to match a packed capture build,
+//  -DBENCH_HOLD_CYCLES=N to try replies faster or slower than the spec):
+//    g++ -O2 -o maple_decode_bench maple_decode_bench.cpp
+//
+//  Usage:
+//    maple_decode_bench [frames] [capture files...]
+//
+//  Synthesizes reply frames with every bus state held for the shortest
+//  time a device may hold it (MAPLE_SPEC_SAMPLE_MAX_NS), samples them on
+//  the same cycle grid as the generated rxcode.asm (rxcode_packed.asm
+//  with -DMAPLE_CAPTURE_PACKED), and runs both decoders on every
+//  capture. Raw dumps of maplebuf can be given as extra arguments to
+//  replay real captures. Exits non zero if the decoders disagree, or if
+//  a frame that fits in the capture window doesn't decode to the bytes
+//  that were sent.
+//
+//  Host timings only compare the two decoders with each other; on the
+//  adapter use MAPLE_PROFILE in MapleBus.h for the real cycle count.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../AnimatorDreamcast2.4GHz/MapleDecode.h"
+#ifdef MAPLE_CAPTURE_PACKED
+#include "../AnimatorDreamcast2.4GHz/rxcode_packed.h"
+#else
+#include "../AnimatorDreamcast2.4GHz/rxcode.h"
+#endif
+
+/******************** Macros *****************************/
+
+#define BENCH_SAMPLES MAPLE_RX_SAMPLES
+#define BENCH_BUF_SIZE MAPLE_RX_BYTES
+#define BENCH_MAXLEN 30 //Same limit Dreamcast.h uses for replies
+#ifndef BENCH_HOLD_CYCLES
+#define BENCH_HOLD_CYCLES 4 //Shortest bus state of a reply at 16MHz (MAPLE_SPEC_SAMPLE_MAX_NS, 250ns)
+#endif
+#define BENCH_UNKNOWN (-100) //Capture::expect when there is nothing to compare with (not a decoder result)
+
+/******************* Globals *****************************/
+
+typedef int (*Decoder)(const volatile unsigned char *, unsigned int, unsigned char *, unsigned int);
+
+struct Capture {
+	unsigned char buf[BENCH_BUF_SIZE];
+	int expect; //Result the decoders must return, BENCH_UNKNOWN if there is no telling
+	unsigned char data[BENCH_MAXLEN+4]; //Bytes they must return (words reversed, LRC last)
+};
+
+/******************** Functions **************************/
+
+//Append cycles of one bus state (pin 1 in bit 0, pin 5 in bit 1)
+static void Wave_Put(std::vector<unsigned char> &wave, unsigned char state, int cycles){
+	while(cycles--){
+		wave.push_back(state);
+	}
+}
+
+//Build a frame waveform, every state held BENCH_HOLD_CYCLES. Returns the cycle the end of frame is complete at
+static size_t Wave_Frame(std::vector<unsigned char> &wave, const unsigned char *bytes, int len){
+	const int h = BENCH_HOLD_CYCLES;
+	wave.clear();
+	Wave_Put(wave, 3, 30);
+	//Start of frame: pin 1 low, four pulses on pin 5
+	Wave_Put(wave, 2, h);
+	Wave_Put(wave, 0, h);
+	for(int k=0; k<3; k++){
+		Wave_Put(wave, 2, h);
+		Wave_Put(wave, 0, h);
+	}
+	Wave_Put(wave, 2, h);
+	Wave_Put(wave, 3, h);
+	Wave_Put(wave, 1, h); //Initial phase 1 state, where the decoder starts
+	//Two bits per phase pair: data set up while the clock pin is high, held after it falls
+	for(int i=0; i<len; i++){
+		for(int b=7; b>=0; b-=2){
+			int b1 = (bytes[i] >> b) & 1;
+			int b2 = (bytes[i] >> (b-1)) & 1;
+			Wave_Put(wave, 1 | (b1<<1), h);
+			Wave_Put(wave, (b1<<1), h);
+			Wave_Put(wave, 2 | b2, h);
+			Wave_Put(wave, b2, h);
+		}
+	}
+	//End of frame: pin 5 low, pulses on pin 1
+	unsigned char st = wave.back();
+	Wave_Put(wave, st | 1, h);
+	Wave_Put(wave, 3, h);
+	Wave_Put(wave, 1, h);
+	Wave_Put(wave, 0, h);
+	Wave_Put(wave, 1, h);
+	Wave_Put(wave, 0, h);
+	Wave_Put(wave, 1, h);
+	size_t end = wave.size();
+	Wave_Put(wave, 3, 200);
+	return end;
+}
+
+//Sample a waveform starting at offset, like the capture loop. The generated samplers take every sample
+//MAPLE_RX_CYCLES after the previous one, both samples of a packed byte included (generate_rxcode pads them to it)
+static void Wave_Sample(const std::vector<unsigned char> &wave, int offset, Capture &cap){
+	memset(cap.buf, 0, sizeof(cap.buf));
+	for(int i=0; i<BENCH_SAMPLES; i++){
+		size_t c = offset + (size_t)i*MAPLE_RX_CYCLES;
+		unsigned char s = c < wave.size() ? wave[c] : 3;
+#ifdef MAPLE_CAPTURE_PACKED
+		cap.buf[i>>1] |= (i & 1) ? s : (s << 4);
+#else
+		cap.buf[i] = s;
+#endif
+	}
+}
+
+//Random controller sized frames, with a few bad LRCs and truncated frames mixed in
+static void Capture_Synthesize(std::vector<Capture> &caps, int frames){
+	std::vector<unsigned char> wave;
+	srand(1);
+	for(int t=0; t<frames; t++){
+		unsigned char f[64];
+		int len = (rand() % 7) * 4 + 4;
+		unsigned char lrc = 0;
+		for(int i=0; i<len; i++){
+			f[i] = rand();
+			lrc ^= f[i];
+		}
+		f[len++] = (rand() % 10) ? lrc : lrc ^ 1;
+		if(rand() % 15 == 0){
+			len--; //Frame error
+		}
+		size_t end = Wave_Frame(wave, f, len);
+		Capture cap;
+		int offset = rand() % MAPLE_RX_CYCLES;
+		Wave_Sample(wave, offset, cap);
+		//What the decoders must make of it: the bytes, words reversed, if the frame was complete and inside the window
+		memset(cap.data, 0, sizeof(cap.data));
+		if(offset + (size_t)(BENCH_SAMPLES - 1) * MAPLE_RX_CYCLES < end){
+			cap.expect = BENCH_UNKNOWN; //Cut off by the end of the capture
+		}
+		else if(len % 4 != 1 || f[len-1] != lrc){
+			cap.expect = -2;
+		}
+		else{
+			for(int i=0; i<len-1; i++){
+				cap.data[(i & ~3) + 3 - (i & 3)] = f[i];
+			}
+			cap.data[len-1] = f[len-1];
+			cap.expect = len - 1;
+		}
+		caps.push_back(cap);
+	}
+}
+
+//Load raw maplebuf dumps
+static bool Capture_Load(std::vector<Capture> &caps, const char *path){
+	FILE *fp = fopen(path, "rb");
+	if(!fp){
+		perror(path);
+		return false;
+	}
+	Capture cap;
+	size_t n = fread(cap.buf, 1, sizeof(cap.buf), fp);
+	fclose(fp);
+	if(n != sizeof(cap.buf)){
+		fprintf(stderr, "%s: expected %d bytes, got %u\n", path, BENCH_BUF_SIZE, (unsigned)n);
+		return false;
+	}
+	cap.expect = BENCH_UNKNOWN;
+	caps.push_back(cap);
+	return true;
+}
+
+//Average nanoseconds per frame over a few passes of every capture
+static double Bench_Run(Decoder decode, const std::vector<Capture> &caps, unsigned &sink){
+	const int passes = 20;
+	unsigned char data[BENCH_MAXLEN+4];
+	auto start = std::chrono::steady_clock::now();
+	for(int p=0; p<passes; p++){
+		for(const Capture &cap : caps){
+			sink += decode(cap.buf, BENCH_SAMPLES, data, BENCH_MAXLEN) + data[0];
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+	double ns = std::chrono::duration<double, std::nano>(end - start).count();
+	return ns / ((double)passes * caps.size());
+}
+
+int main(int argc, char **argv){
+	std::vector<Capture> caps;
+	int frames = argc > 1 ? atoi(argv[1]) : 20000;
+	Capture_Synthesize(caps, frames);
+	for(int i=2; i<argc; i++){
+		if(!Capture_Load(caps, argv[i])){
+			return 2;
+		}
+	}
+
+	//Both decoders must agree on every result byte, and with the frame that was sent when it is known
+	int mismatches = 0;
+	int wrong = 0, checked = 0;
+	int results[5] = {0}; //overflow, lrc/frame error, timeout, empty, ok
+	for(size_t t=0; t<caps.size(); t++){
+		unsigned char a[BENCH_MAXLEN+4], b[BENCH_MAXLEN+4];
+		memset(a, 0, sizeof(a));
+		memset(b, 0, sizeof(b));
+		int ra = maple_decode_branch(caps[t].buf, BENCH_SAMPLES, a, BENCH_MAXLEN);
+		int rb = maple_decode_lut(caps[t].buf, BENCH_SAMPLES, b, BENCH_MAXLEN);
+		if(ra != rb || (ra > 0 && memcmp(a, b, ra+1))){
+			if(mismatches++ < 5){
+				printf("capture %u: branch %d, table %d\n", (unsigned)t, ra, rb);
+			}
+		}
+		results[ra > 0 ? 4 : ra + 3]++;
+		if(caps[t].expect != BENCH_UNKNOWN){
+			checked++;
+			if(rb != caps[t].expect || (rb > 0 && memcmp(b, caps[t].data, rb+1))){
+				if(wrong++ < 5){
+					printf("capture %u: table %d, sent %d\n", (unsigned)t, rb, caps[t].expect);
+				}
+			}
+		}
+	}
+	printf("%u captures: %d ok, %d empty, %d lrc/frame errors, %d overflows, %d timeouts\n",
+		(unsigned)caps.size(), results[4], results[3], results[1], results[0], results[2]);
+
+	unsigned sink = 0;
+	double branch_ns = Bench_Run(maple_decode_branch, caps, sink);
+	double lut_ns = Bench_Run(maple_decode_lut, caps, sink);
+	printf("branch decoder: %8.1f ns/frame\n", branch_ns);
+	printf("table decoder:  %8.1f ns/frame (%.2fx)\n", lut_ns, branch_ns / lut_ns);
+	printf("mismatches: %d (%u)\n", mismatches, sink & 1);
+	printf("decoded differently from what was sent: %d of %d complete frames\n", wrong, checked);
+
+	return (mismatches || wrong) ? 1 : 0;
+}
@@ -0,0 +1,334 @@
+//-----------------------------------------------------------------------------
+//
+//  maple_dump.cpp
+//
+//  Swallowtail Maple Capture Dump Viewer
+//  Host tool: decodes the Maple captures streamed by MAPLE_DUMP
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build:
+//    g++ -O2 -o maple_dump maple_dump.cpp
+//
+//  Usage:
+//    stty -F /dev/ttyUSB0 57600 raw -echo
+//    maple_dump [--save dir] /dev/ttyUSB0|capture.log
+//
+//  Reads the frames MapleBus.h sends out of PC3 when MAPLE_DUMP is set
+//  (see Serial.h and CaptureDump.h), resyncs on the sync bytes and
+//  drops anything that fails the CRC. Each capture is run through the
+//  same decoder as the adapter and printed with its header, payload,
+//  LRC status and the phase timings seen on the bus. With --save every
+//  capture is also written out one sample per byte, the format
+//  maple_decode_bench replays, so odd devices become test fixtures.
+//  Counter reports (STATS_REPORT in main.c) are printed as they come.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../AnimatorDreamcast2.4GHz/MapleDecode.h"
+#include "../AnimatorDreamcast2.4GHz/Serial.h"
+#include "../AnimatorDreamcast2.4GHz/CaptureDump.h"
+
+/******************** Macros *****************************/
+
+#define DUMP_MAXLEN 1024 //Longest reply decoded (the adapter itself stops at 30 bytes)
+#define DUMP_FRAME_MAX 4096 //Longest payload accepted before the frame is taken as noise
+
+/******************* Globals *****************************/
+
+//Running totals over the whole stream
+struct DumpStats {
+	unsigned frames; //Capture frames that passed the CRC
+	unsigned reports; //Counter reports that passed the CRC
+	unsigned crc_errors; //Frames dropped for a bad CRC
+	unsigned lost; //Captures skipped by the adapter (sequence gaps)
+	unsigned mismatches; //Captures the host decoded differently from the adapter
+	double phase_min_ns; //Shortest data phase seen
+	double phase_max_ns; //Longest data phase seen
+};
+
+static const char *save_dir = NULL;
+
+/******************** Functions **************************/
+
+//Turn the capture payload back into one sample per byte, returns false if it doesn't add up
+static bool Capture_Expand(const unsigned char *data, unsigned length, unsigned char flags, unsigned samples, std::vector<unsigned char> &out){
+	out.clear();
+	if(flags & CAPTURE_FLAG_EDGES){
+		for(unsigned i=0; i<length; i++){
+			for(int k=0; k<CAPTURE_RUN_LENGTH(data[i]); k++){
+				out.push_back(CAPTURE_RUN_STATE(data[i]));
+			}
+		}
+	}
+	else{
+		unsigned expected = (flags & CAPTURE_FLAG_PACKED) ? (samples + 1) / 2 : samples;
+		if(length != expected){
+			return false;
+		}
+		for(unsigned i=0; i<samples; i++){
+			out.push_back(CaptureDump_Sample(data, i, flags & CAPTURE_FLAG_PACKED));
+		}
+	}
+	return out.size() == samples;
+}
+
+//Phase lengths of the data part in samples: time between two falling edges that carry a bit
+static void Capture_Phases(const std::vector<unsigned char> &s, std::vector<int> &phases, int &glitches){
+	unsigned i = maple_decode_start(s.data(), s.size());
+	unsigned char last = i < s.size() ? s[i] : 3, last_fell = 0;
+	long last_edge = -1;
+	phases.clear();
+	glitches = 0;
+	for(; i<s.size(); i++){
+		unsigned char cur = s[i];
+		unsigned char fell = last & (cur ^ last);
+		last = cur;
+		if(!fell){
+			continue;
+		}
+		if(fell == last_fell){
+			break; //End of frame
+		}
+		if(fell == 0x03){
+			glitches++;
+		}
+		if(last_edge >= 0){
+			phases.push_back(i - last_edge);
+		}
+		last_edge = i;
+		last_fell = fell;
+	}
+}
+
+//Write the samples the way maple_decode_bench loads them
+static void Capture_Save(const std::vector<unsigned char> &s, unsigned seq){
+	std::string path = std::string(save_dir) + "/capture_" + std::to_string(seq) + ".bin";
+	FILE *fp = fopen(path.c_str(), "wb");
+	if(!fp){
+		perror(path.c_str());
+		return;
+	}
+	fwrite(s.data(), 1, s.size(), fp);
+	fclose(fp);
+}
+
+static const char *Result_Name(int result){
+	switch(result){
+		case -1: return "no reply";
+		case -2: return "LRC/frame error";
+		case -3: return "too long";
+	}
+	return result ? "ok" : "empty";
+}
+
+//Print one capture frame
+static void Dump_Capture(const unsigned char *p, unsigned length, DumpStats &stats, int &next_seq){
+	if(length < CAPTURE_HEADER_SIZE){
+		printf("short capture frame (%u bytes)\n", length);
+		return;
+	}
+	int result = (signed char)p[0];
+	unsigned seq = p[1];
+	unsigned char flags = p[2];
+	unsigned cycles = p[3];
+	double f_cpu = p[4] * 100000.0;
+	unsigned samples = p[5] | (p[6] << 8);
+	double sample_ns = cycles * 1e9 / f_cpu;
+
+	if(next_seq >= 0 && seq != (unsigned)next_seq){
+		stats.lost += (seq - next_seq) & 0xFF;
+	}
+	next_seq = (seq + 1) & 0xFF;
+
+	std::vector<unsigned char> s;
+	if(!Capture_Expand(p + CAPTURE_HEADER_SIZE, length - CAPTURE_HEADER_SIZE, flags, samples, s)){
+		printf("#%u: capture doesn't hold %u samples\n", seq, samples);
+		return;
+	}
+
+	unsigned char data[DUMP_MAXLEN + 4];
+	int res = maple_decode_lut(s.data(), s.size(), data, DUMP_MAXLEN);
+	printf("#%u: adapter %d (%s), host %d (%s), %u samples at %.1f ns (%s)\n", seq, result, Result_Name(result),
+		res, Result_Name(res), samples, sample_ns, (flags & CAPTURE_FLAG_EDGES) ? "runs" : "raw");
+	//The adapter gives up at 30 bytes, so a long reply is only a mismatch if it fails here too
+	if(res != result && !(result == -3 && res > 0)){
+		stats.mismatches++;
+	}
+
+	//What made it into data is valid even when the frame failed
+	int bytes = res > 0 ? res + 1 : 0;
+	if(bytes >= 4){
+		printf("  header: command %u, destination 0x%02X, source 0x%02X, %u words\n", data[0], data[1], data[2], data[3]);
+	}
+	for(int i=0; i<bytes; i++){
+		printf("%s%02X", (i % 16) ? " " : "  ", data[i]);
+		if(i % 16 == 15 || i == bytes - 1){
+			printf("\n");
+		}
+	}
+
+	std::vector<int> phases;
+	int glitches;
+	Capture_Phases(s, phases, glitches);
+	if(!phases.empty()){
+		int lo = phases[0], hi = phases[0];
+		long sum = 0;
+		for(int ph : phases){
+			lo = ph < lo ? ph : lo;
+			hi = ph > hi ? ph : hi;
+			sum += ph;
+		}
+		double lo_ns = lo * sample_ns, hi_ns = hi * sample_ns;
+		printf("  %u clock edges, phase %.0f/%.0f/%.0f ns (min/avg/max), %d glitches\n", (unsigned)phases.size() + 1,
+			lo_ns, (double)sum / phases.size() * sample_ns, hi_ns, glitches);
+		if(stats.frames == 0 || lo_ns < stats.phase_min_ns){
+			stats.phase_min_ns = lo_ns;
+		}
+		if(hi_ns > stats.phase_max_ns){
+			stats.phase_max_ns = hi_ns;
+		}
+	}
+	if(save_dir){
+		Capture_Save(s, seq);
+	}
+}
+
+static unsigned Word(const unsigned char *p){
+	return p[0] | (p[1] << 8);
+}
+
+//Print one counter report: scheduler counters per task over the last window, Maple error counters since power up
+static void Dump_Stats(const unsigned char *p, unsigned length){
+	if(length < 3 || length < 3 + p[2] * 10u + 6 + 12){
+		printf("short counter report (%u bytes)\n", length);
+		return;
+	}
+	double ticks_per_us = Word(p) / 1000.0;
+	unsigned tasks = p[2];
+	const unsigned char *q = p + 3;
+	printf("counters:\n");
+	for(unsigned i=0; i<tasks; i++, q+=10){
+		unsigned runs = Word(q);
+		unsigned long total = Word(q + 6) | ((unsigned long)Word(q + 8) << 16);
+		printf("  task %u: %u runs, %u deadline misses, %.0f us max, %.1f us avg\n", i, runs, Word(q + 2),
+			Word(q + 4) / ticks_per_us, runs ? total / ticks_per_us / runs : 0.0);
+	}
+	printf("  stack: %u bytes deepest, %u bytes of SRAM never used\n", Word(q), Word(q + 2));
+	if(Word(q + 4) != 0xFFFF){
+		printf("  arena: %u overlapping claims%s\n", Word(q + 4), Word(q + 4) ? " (a phase lost its data)" : "");
+	}
+	q += 6;
+	printf("  maple: %u timeouts, %u LRC/frame errors (%u fixed by a retry), %u too long, %u resets, %u reconnects\n",
+		Word(q), Word(q + 2), Word(q + 6), Word(q + 4), Word(q + 8), Word(q + 10));
+	static const char *bins[] = { "<10ms", "<100ms", "<1s", "<10s" };
+	unsigned nbins = (length - (q + 12 - p)) / 2;
+	printf("  reconnect time:");
+	for(unsigned i=0; i<nbins; i++){
+		printf(" %s %u", i < nbins - 1 && i < 4 ? bins[i] : "longer", Word(q + 12 + i * 2));
+	}
+	printf("\n");
+}
+
+int main(int argc, char **argv){
+	const char *path = NULL;
+	for(int i=1; i<argc; i++){
+		if(!strcmp(argv[i], "--save") && i + 1 < argc){
+			save_dir = argv[++i];
+		}
+		else{
+			path = argv[i];
+		}
+	}
+	if(!path){
+		fprintf(stderr, "usage: maple_dump [--save dir] /dev/ttyUSB0|capture.log\n");
+		return 2;
+	}
+	FILE *fp = fopen(path, "rb");
+	if(!fp){
+		perror(path);
+		return 2;
+	}
+
+	DumpStats stats;
+	memset(&stats, 0, sizeof(stats));
+	int next_seq = -1;
+	std::vector<unsigned char> buf;
+	int c;
+	while((c = fgetc(fp)) != EOF){
+		buf.push_back(c);
+		//Drop bytes until the buffer starts with the sync
+		while(!buf.empty() && (buf[0] != SERIAL_SYNC0 || (buf.size() > 1 && buf[1] != SERIAL_SYNC1))){
+			buf.erase(buf.begin());
+		}
+		if(buf.size() < SERIAL_HEADER_SIZE){
+			continue;
+		}
+		unsigned length = buf[3] | (buf[4] << 8);
+		if(length > DUMP_FRAME_MAX){
+			buf.erase(buf.begin());
+			continue;
+		}
+		if(buf.size() < SERIAL_HEADER_SIZE + length + 2){
+			continue;
+		}
+		uint16_t crc = SERIAL_CRC_INIT;
+		for(unsigned i=2; i<SERIAL_HEADER_SIZE + length; i++){
+			crc = Serial_CRC(crc, buf[i]);
+		}
+		if((buf[SERIAL_HEADER_SIZE + length] | (buf[SERIAL_HEADER_SIZE + length + 1] << 8)) != crc){
+			//Noise that looked like a sync, look for the next one inside it
+			stats.crc_errors++;
+			buf.erase(buf.begin());
+			continue;
+		}
+		if(buf[2] == SERIAL_TYPE_CAPTURE){
+			Dump_Capture(&buf[SERIAL_HEADER_SIZE], length, stats, next_seq);
+			stats.frames++;
+		}
+		else if(buf[2] == SERIAL_TYPE_STATS){
+			Dump_Stats(&buf[SERIAL_HEADER_SIZE], length);
+			stats.reports++;
+		}
+		buf.erase(buf.begin(), buf.begin() + SERIAL_HEADER_SIZE + length + 2);
+		fflush(stdout);
+	}
+	fclose(fp);
+
+	printf("%u captures, %u counter reports, %u CRC errors, %u not sent by the adapter, %u decoded differently\n",
+		stats.frames, stats.reports, stats.crc_errors, stats.lost, stats.mismatches);
+	if(stats.frames){
+		printf("data phases between %.0f and %.0f ns\n", stats.phase_min_ns, stats.phase_max_ns);
+	}
+	return stats.mismatches ? 1 : 0;
+}
@@ -0,0 +1,279 @@
+//-----------------------------------------------------------------------------
+//
+//  maple_timing_check.cpp
+//
+//  Swallowtail Maple Timing Check
+//  Host tool: checks the Maple sender and sampler timing for a clock
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build and run (16MHz is the only clock MapleTiming.h supports, any
+//  other one reports that there is no timing table and exits non zero):
+//    g++ -O2 -DF_CPU=16000000UL -o maple_timing_check maple_timing_check.cpp && ./maple_timing_check
+//
+//  Runs the sender instructions from MapleTiming.h (start of frame, a
+//  few bytes with the longest gap between bytes, end of frame) cycle by
+//  cycle, the way the AVR executes them, and measures what ends up on
+//  pin 1 and pin 5: data phase lengths, data setup before each clock
+//  edge, the start/end of frame pulses, and that the bits read back at
+//  the clock edges are the bytes sent. The period of both generated
+//  samplers (rxcode.h and rxcode_packed.h) is checked too; a sampler
+//  generated for another clock fails, the adapter wouldn't build with
+//  it. Everything is compared with the MAPLE_SPEC_* limits; exits non
+//  zero if anything is out of spec.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#ifndef F_CPU
+#error "F_CPU is not defined, pass the clock to check with -DF_CPU (e.g. -DF_CPU=16000000UL)"
+#endif
+#include "../AnimatorDreamcast2.4GHz/MapleTiming.h"
+//Both samplers define the same MAPLE_RX_* names, keep the plain one's before taking in the packed one
+#include "../AnimatorDreamcast2.4GHz/rxcode.h"
+static const unsigned long rx_plain_f_cpu = MAPLE_RX_F_CPU;
+static const int rx_plain_cycles = MAPLE_RX_CYCLES;
+#undef MAPLE_RX_F_CPU
+#undef MAPLE_RX_CYCLES
+#undef MAPLE_RX_SAMPLES
+#undef MAPLE_RX_BYTES
+#undef MAPLE_RX_PACKED
+#include "../AnimatorDreamcast2.4GHz/rxcode_packed.h"
+
+/******************** Macros *****************************/
+
+#define CHECK_NS(cycles) ((double)(cycles) * 1e9 / F_CPU)
+
+/******************* Globals *****************************/
+
+//Pin state after an instruction that changed it
+struct Edge {
+	long cycle; //Cycle count when the instruction finished
+	unsigned char port; //Pin 1 in bit 0, pin 5 in bit 1
+	int section; //Which part of the frame it belongs to
+};
+
+enum { SECTION_SYNC, SECTION_DATA, SECTION_EOF };
+
+static const unsigned char check_bytes[] = { 0xA5, 0x3C, 0xFF, 0x00 };
+
+/******************** Functions **************************/
+
+//Register number of "rN"
+static int Reg(const char *s){
+	while(*s && *s != 'r'){
+		s++;
+	}
+	return atoi(s + 1);
+}
+
+//Run a block of instructions, appending an edge whenever the pins change
+static void Run(const std::string &code, int section, unsigned char *regs, unsigned char &port, long &cycle, std::vector<Edge> &edges){
+	size_t pos = 0;
+	int skip = 0;
+	while(pos < code.size()){
+		size_t end = code.find('\n', pos);
+		if(end == std::string::npos){
+			end = code.size();
+		}
+		std::string line = code.substr(pos, end - pos);
+		pos = end + 1;
+		size_t first = line.find_first_not_of(" \t");
+		if(first == std::string::npos){
+			continue;
+		}
+		line = line.substr(first);
+		char op[8] = "";
+		sscanf(line.c_str(), "%7s", op);
+		const char *args = line.c_str() + strlen(op);
+		unsigned char before = port;
+		if(skip){
+			//Skipped one word instruction: sbrc took one more cycle
+			skip = 0;
+			cycle += 1;
+			continue;
+		}
+		if(!strcmp(op, "nop")){
+			cycle += 1;
+		}
+		else if(!strcmp(op, "sbi") || !strcmp(op, "cbi")){
+			int bit = atoi(strchr(args, ',') + 1);
+			port = op[0] == 's' ? (port | (1<<bit)) : (port & ~(1<<bit));
+			cycle += 2;
+		}
+		else if(!strcmp(op, "out")){
+			port = regs[Reg(strchr(args, ',') + 1)] & 0x03;
+			cycle += 1;
+		}
+		else if(!strcmp(op, "ldi")){
+			regs[Reg(args)] = (unsigned char)strtol(strchr(args, ',') + 1, NULL, 0);
+			cycle += 1;
+		}
+		else if(!strcmp(op, "sbrc")){
+			int bit = atoi(strchr(args, ',') + 1);
+			skip = !(regs[Reg(args)] & (1<<bit));
+			cycle += 1;
+		}
+		else{
+			fprintf(stderr, "unknown instruction: %s\n", line.c_str());
+			exit(2);
+		}
+		if(port != before){
+			edges.push_back({ cycle, port, section });
+		}
+	}
+}
+
+//Report one measurement against its limit, returns 1 if it is in spec
+static int Report(const char *what, double ns, const char *cmp, double limit){
+	int ok = (cmp[0] == '>') ? (ns >= limit) : (ns <= limit);
+	printf("  %-36s %8.1f ns  %s %6.0f ns  %s\n", what, ns, cmp, limit, ok ? "ok" : "OUT OF SPEC");
+	return ok;
+}
+
+//Sampler period of a generated rxcode, which has to be generated for the clock being checked
+static int Report_Sampler(const char *what, unsigned long f_cpu, int cycles){
+	char label[64];
+	snprintf(label, sizeof(label), "%s (%d cycles)", what, cycles);
+	if(f_cpu != F_CPU){
+		printf("  %-36s generated for %lu Hz, re-run generate_rxcode\n", label, f_cpu);
+		return 0;
+	}
+	return Report(label, CHECK_NS(cycles), "<=", MAPLE_SPEC_SAMPLE_MAX_NS);
+}
+
+int main(){
+	unsigned char regs[32] = { 0 };
+	unsigned char port = 0x03;
+	long cycle = 0;
+	std::vector<Edge> edges;
+	int ok = 1;
+
+	printf("F_CPU %lu Hz\n", (unsigned long)F_CPU);
+	if(!MAPLE_TIMING_SUPPORTED){
+		printf("  no timing table for this clock\n");
+		return 1;
+	}
+
+	//Same register set-up as the senders in MapleBus.h
+	regs[20] = 0x01;
+	regs[21] = 0x02;
+	regs[16] = check_bytes[0];
+	Run(MAPLE_TX_PH1(7), SECTION_SYNC, regs, port, cycle, edges);
+	Run(MAPLE_TX_SYNC, SECTION_SYNC, regs, port, cycle, edges);
+	for(size_t i=0; i<sizeof(check_bytes); i++){
+		Run(MAPLE_TX_BYTE, SECTION_DATA, regs, port, cycle, edges);
+		//Longest loop overhead before the next byte, then its first phase
+		std::string gap;
+		for(int c=0; c<MAPLE_TX_GAP_MAX_CYCLES; c++){
+			gap += "nop\n";
+		}
+		Run(gap, SECTION_DATA, regs, port, cycle, edges);
+		if(i + 1 < sizeof(check_bytes)){
+			regs[16] = check_bytes[i + 1];
+			Run(MAPLE_TX_PH1(7), SECTION_DATA, regs, port, cycle, edges);
+		}
+	}
+	Run(MAPLE_TX_EOF, SECTION_EOF, regs, port, cycle, edges);
+
+	//Data: a falling edge of the clock pin (pin 1 then pin 5) latches the other pin
+	long last_fall = -1, phase_min = 1L<<30, phase_max = 0, setup_min = 1L<<30;
+	long last_change[2] = { 0, 0 };
+	unsigned char prev = 0x03;
+	std::vector<int> bits;
+	for(const Edge &e : edges){
+		for(int pin=0; pin<2; pin++){
+			int was = (prev >> pin) & 1, now = (e.port >> pin) & 1;
+			if(was == now){
+				continue;
+			}
+			if(e.section == SECTION_DATA && was && !now){
+				int other = !pin;
+				if(last_fall >= 0){
+					long phase = e.cycle - last_fall;
+					phase_min = phase < phase_min ? phase : phase_min;
+					phase_max = phase > phase_max ? phase : phase_max;
+				}
+				long setup = e.cycle - last_change[other];
+				setup_min = setup < setup_min ? setup : setup_min;
+				bits.push_back((e.port >> other) & 1);
+				last_fall = e.cycle;
+			}
+			last_change[pin] = e.cycle;
+		}
+		prev = e.port;
+	}
+
+	//Start/end of frame: pulses of one pin while the other one is held low
+	long pulse_min = 1L<<30;
+	long pulse_start[2] = { -1, -1 };
+	prev = 0x03;
+	for(const Edge &e : edges){
+		if(e.section != SECTION_DATA){
+			for(int pin=0; pin<2; pin++){
+				int was = (prev >> pin) & 1, now = (e.port >> pin) & 1;
+				int other_low = !((prev >> !pin) & 1) && !((e.port >> !pin) & 1);
+				if(was != now){
+					if(pulse_start[pin] >= 0 && other_low){
+						long pulse = e.cycle - pulse_start[pin];
+						pulse_min = pulse < pulse_min ? pulse : pulse_min;
+					}
+					pulse_start[pin] = other_low ? e.cycle : -1;
+				}
+			}
+		}
+		prev = e.port;
+	}
+
+	//The bits read back at the clock edges must be the bytes sent
+	int errors = (bits.size() != sizeof(check_bytes) * 8);
+	for(size_t i=0; !errors && i<bits.size(); i++){
+		errors += bits[i] != ((check_bytes[i / 8] >> (7 - i % 8)) & 1);
+	}
+	printf("  %-36s %8zu bits  %s\n", "data read back at the clock edges", bits.size(), errors ? "WRONG" : "ok");
+	ok &= !errors;
+
+	ok &= Report("shortest data phase", CHECK_NS(phase_min), ">=", MAPLE_SPEC_PHASE_MIN_NS);
+	ok &= Report("longest data phase (byte boundary)", CHECK_NS(phase_max), "<=", MAPLE_SPEC_PHASE_MAX_NS);
+	ok &= Report("data setup before the clock edge", CHECK_NS(setup_min), ">=", MAPLE_SPEC_SETUP_NS);
+	ok &= Report("shortest start/end of frame pulse", CHECK_NS(pulse_min), ">=", MAPLE_SPEC_SYNC_PULSE_NS);
+	ok &= Report_Sampler("rxcode.h sampler", rx_plain_f_cpu, rx_plain_cycles);
+	ok &= Report_Sampler("rxcode_packed.h sampler", MAPLE_RX_F_CPU, MAPLE_RX_CYCLES);
+
+	//The numbers MapleBus.h asserts on must agree with what was measured
+	if(phase_min != MAPLE_TX_PHASE_CYCLES || phase_max != MAPLE_TX_PHASE_CYCLES + MAPLE_TX_GAP_MAX_CYCLES || pulse_min != MAPLE_DLY_SYNC_CYCLES + 2){
+		printf("  MapleTiming.h cycle counts don't match the instructions (phase %ld-%ld, pulse %ld)\n", phase_min, phase_max, pulse_min);
+		ok = 0;
+	}
+	printf("  %s\n", ok ? "PASS" : "FAIL");
+	return ok ? 0 : 1;
+}
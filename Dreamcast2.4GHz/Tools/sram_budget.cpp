@@ -0,0 +1,326 @@
+//-----------------------------------------------------------------------------
+//
+//  sram_budget.cpp
+//
+//  Swallowtail SRAM Budget
+//  Host tool: static RAM per module from a linker map file
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build:
+//    g++ -O2 -o sram_budget sram_budget.cpp
+//
+//  Usage:
+//    sram_budget [--ram BYTES] [--stack BYTES] [--min-free BYTES] [--symbols] FILE.map SOURCE_DIR
+//
+//  Every module is a header pulled into main.c, so the map only knows
+//  main.o. With -fdata-sections each variable still gets its own
+//  .data.NAME/.bss.NAME section, and maplebuf shows up in COMMON. The
+//  tool reads those sizes, then looks in SOURCE_DIR for the file that
+//  declares each name. It prints static RAM per module, plus what is
+//  left once the stack is added:
+//
+//    --ram       SRAM of the part (default 1024, ATmega168PB)
+//    --stack     stack to budget for, Stack_HighWater() as read back
+//                from the adapter (default 256)
+//    --min-free  fail (exit 1) if less than this is left (default 0)
+//
+//  The project files run it after every build when the tool is built,
+//  so a change that eats into the stack fails there and not in the
+//  field.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/******************* Globals *****************************/
+
+struct Options {
+	unsigned ram = 1024;
+	unsigned stack = 256;
+	unsigned min_free = 0;
+	bool symbols = false;
+	std::string map;
+	std::string source;
+};
+
+//One variable placed by the linker
+struct Symbol {
+	std::string name; //As declared (the .NNNN suffix of function statics removed)
+	std::string section; //.data, .bss or .noinit
+	unsigned long addr;
+	unsigned long size;
+	std::string module; //File declaring it
+};
+
+//Totals of one module
+struct Module {
+	unsigned long data = 0;
+	unsigned long bss = 0;
+};
+
+/******************** Functions **************************/
+
+static void Usage(const char *name){
+	fprintf(stderr, "usage: %s [--ram BYTES] [--stack BYTES] [--min-free BYTES] [--symbols] FILE.map SOURCE_DIR\n", name);
+	exit(2);
+}
+
+//Parse the command line, exit with a message on anything unexpected
+static Options Options_Parse(int argc, char **argv){
+	Options opt;
+	std::vector<std::string> files;
+	for(int i=1; i<argc; i++){
+		std::string arg = argv[i];
+		if(arg == "--symbols"){
+			opt.symbols = true;
+			continue;
+		}
+		if(arg.compare(0, 2, "--") != 0){
+			files.push_back(arg);
+			continue;
+		}
+		if(i+1 >= argc){
+			Usage(argv[0]);
+		}
+		unsigned val = strtoul(argv[++i], NULL, 0);
+		if(arg == "--ram"){
+			opt.ram = val;
+		}
+		else if(arg == "--stack"){
+			opt.stack = val;
+		}
+		else if(arg == "--min-free"){
+			opt.min_free = val;
+		}
+		else{
+			Usage(argv[0]);
+		}
+	}
+	if(files.size() != 2){
+		Usage(argv[0]);
+	}
+	opt.map = files[0];
+	opt.source = files[1];
+	return opt;
+}
+
+//Split a line on white space
+static std::vector<std::string> Tokens(const std::string &line){
+	std::vector<std::string> t;
+	std::istringstream in(line);
+	std::string s;
+	while(in >> s){
+		t.push_back(s);
+	}
+	return t;
+}
+
+static bool Is_Hex(const std::string &s){
+	return s.size() > 2 && s[0] == '0' && s[1] == 'x';
+}
+
+//Variable name of an input section (.bss.name.1234 -> name)
+static std::string Section_Name(const std::string &input, const std::string &section){
+	std::string name = input.substr(section.size() + 1);
+	size_t dot = name.rfind('.');
+	if(dot != std::string::npos && name.find_first_not_of("0123456789", dot + 1) == std::string::npos){
+		name.erase(dot);
+	}
+	return name;
+}
+
+//Read the variables of .data, .bss and .noinit out of the map
+static bool Map_Load(const std::string &path, std::vector<Symbol> &symbols){
+	std::ifstream in(path);
+	if(!in){
+		perror(path.c_str());
+		return false;
+	}
+	std::vector<std::string> lines;
+	std::string line;
+	while(std::getline(in, line)){
+		if(!line.empty() && line.back() == '\r'){
+			line.pop_back();
+		}
+		lines.push_back(line);
+	}
+
+	std::string section;
+	for(size_t i=0; i<lines.size(); i++){
+		const std::string &l = lines[i];
+		std::vector<std::string> t = Tokens(l);
+		if(t.empty()){
+			continue;
+		}
+		//Output sections start in the first column
+		if(l[0] != ' '){
+			section = (t[0] == ".data" || t[0] == ".bss" || t[0] == ".noinit") ? t[0] : "";
+			continue;
+		}
+		if(section.empty()){
+			continue;
+		}
+		//Input section: name, then address and size (on the next line if the name is long)
+		bool named = t[0].compare(0, section.size() + 1, section + ".") == 0;
+		bool common = t[0] == "COMMON" || t[0] == section;
+		if(!named && !common){
+			continue;
+		}
+		std::vector<std::string> v(t.begin() + 1, t.end());
+		if(v.size() < 2 && i + 1 < lines.size()){
+			v = Tokens(lines[++i]);
+		}
+		if(v.size() < 2 || !Is_Hex(v[0]) || !Is_Hex(v[1])){
+			continue;
+		}
+		unsigned long addr = strtoul(v[0].c_str(), NULL, 16);
+		unsigned long size = strtoul(v[1].c_str(), NULL, 16);
+		if(size == 0){
+			continue;
+		}
+		if(named){
+			symbols.push_back({ Section_Name(t[0], section), section, addr, size, "" });
+			continue;
+		}
+		//COMMON (or a plain .bss): the symbols follow as address/name lines, sizes are the gaps between them
+		std::vector<Symbol> block;
+		while(i + 1 < lines.size()){
+			std::vector<std::string> s = Tokens(lines[i + 1]);
+			if(s.size() != 2 || !Is_Hex(s[0]) || lines[i + 1][1] != ' '){
+				break;
+			}
+			block.push_back({ s[1], section, strtoul(s[0].c_str(), NULL, 16), 0, "" });
+			i++;
+		}
+		if(block.empty()){
+			block.push_back({ "(unnamed)", section, addr, 0, "" });
+		}
+		for(size_t k=0; k<block.size(); k++){
+			unsigned long end = (k + 1 < block.size()) ? block[k + 1].addr : addr + size;
+			block[k].size = end - block[k].addr;
+			symbols.push_back(block[k]);
+		}
+	}
+	return true;
+}
+
+//Find the file in the source directory that declares each symbol
+static void Symbols_Locate(std::vector<Symbol> &symbols, const std::string &dir){
+	std::map<std::string, std::string> files;
+	DIR *d = opendir(dir.c_str());
+	if(!d){
+		perror(dir.c_str());
+		return;
+	}
+	while(struct dirent *e = readdir(d)){
+		std::string name = e->d_name;
+		if(name.size() > 2 && (name.compare(name.size() - 2, 2, ".h") == 0 || name.compare(name.size() - 2, 2, ".c") == 0)){
+			std::ifstream in(dir + "/" + name);
+			std::stringstream text;
+			text << in.rdbuf();
+			files[name] = text.str();
+		}
+	}
+	closedir(d);
+
+	for(Symbol &sym : symbols){
+		//A declaration at file scope or a static inside a function (locals don't end up in the map): a type, the name,
+		//then an array size, an initializer or the end of the statement
+		std::regex decl("^([ \\t]+static |static )?(volatile |const )*[A-Za-z_][\\w ]*[\\w\\*] \\**" + sym.name + "[ \\t]*(\\[[^\\]]*\\][ \\t]*)*(=|;)");
+		sym.module = "?";
+		for(const auto &f : files){
+			std::istringstream in(f.second);
+			std::string l;
+			bool found = false;
+			while(std::getline(in, l)){
+				if(l.find(sym.name) != std::string::npos && l.find("extern") == std::string::npos && std::regex_search(l, decl)){
+					found = true;
+					break;
+				}
+			}
+			if(found){
+				sym.module = f.first;
+				break;
+			}
+		}
+	}
+}
+
+int main(int argc, char **argv){
+	Options opt = Options_Parse(argc, argv);
+	std::vector<Symbol> symbols;
+	if(!Map_Load(opt.map, symbols)){
+		return 2;
+	}
+	Symbols_Locate(symbols, opt.source);
+
+	std::map<std::string, Module> modules;
+	unsigned long data = 0, bss = 0;
+	for(const Symbol &sym : symbols){
+		if(sym.section == ".data"){
+			modules[sym.module].data += sym.size;
+			data += sym.size;
+		}
+		else{
+			modules[sym.module].bss += sym.size;
+			bss += sym.size;
+		}
+	}
+
+	printf("%s: %u bytes of SRAM\n", opt.map.c_str(), opt.ram);
+	printf("  %-16s %6s %6s %6s\n", "module", ".data", ".bss", "total");
+	for(const auto &m : modules){
+		printf("  %-16s %6lu %6lu %6lu\n", m.first.c_str(), m.second.data, m.second.bss, m.second.data + m.second.bss);
+		if(opt.symbols){
+			for(const Symbol &sym : symbols){
+				if(sym.module == m.first){
+					printf("      %-24s %-7s 0x%06lX %5lu\n", sym.name.c_str(), sym.section.c_str(), sym.addr, sym.size);
+				}
+			}
+		}
+	}
+	long free = (long)opt.ram - (long)(data + bss) - (long)opt.stack;
+	printf("  %-16s %6lu %6lu %6lu\n", "static", data, bss, data + bss);
+	printf("  %-16s %20u\n", "stack", opt.stack);
+	printf("  %-16s %20ld\n", "free", free);
+	if(free < (long)opt.min_free){
+		printf("SRAM budget exceeded: %ld bytes free, %u wanted\n", free, opt.min_free);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+//
+//  MSPIM.h
+//
+//  Swallowtail USART SPI Master Firmware
+//  AVR (ATmega168PB) USART in Master SPI Mode Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+//USART0 pins in master SPI mode (cannot be used together with UART.h)
+#define MSPIM_SCK PD4 //XCK0
+#define MSPIM_MOSI PD1 //TXD0
+#define MSPIM_MISO PD0 //RXD0
+#define DDR_MSPIM DDRD
+#define PORT_MSPIM PORTD
+
+//SCK = F_CPU / (2 * (MSPIM_UBRR + 1)), 0 gives the fastest clock (F_CPU/2)
+#ifndef MSPIM_UBRR
+#define MSPIM_UBRR 0
+#endif
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+
+/******************* Globals *****************************/
+
+
+/******************** Functions **************************/
+
+//Initialize USART0 as an SPI master, MSB first, Mode 0:0
+void MSPIM_init(){
+	//The baud rate register must be zero while the transmitter is enabled
+	UBRR0H = 0;
+	UBRR0L = 0;
+	//XCK as output selects master mode
+	DDR_MSPIM |= (1<<MSPIM_SCK)|(1<<MSPIM_MOSI)|(0<<MSPIM_MISO);
+	//Set the default values for outputs to zero and inputs to have pull-up resistors
+	PORT_MSPIM |= (0<<MSPIM_SCK)|(0<<MSPIM_MOSI)|(1<<MSPIM_MISO);
+	//Master SPI mode, MSB first, Mode 0:0
+	UCSR0C = (1<<UMSEL01) | (1<<UMSEL00) | (0<<UDORD0) | (0<<UCPHA0) | (0<<UCPOL0);
+	//Enable the receiver and the transmitter
+	UCSR0B = (1<<RXEN0) | (1<<TXEN0);
+	//Set the clock now that the transmitter is running
+	UBRR0H = (uint8_t)(MSPIM_UBRR >> 8);
+	UBRR0L = (uint8_t)MSPIM_UBRR;
+	return; //Return to call point
+}
+
+//Empty the receive buffer
+void MSPIM_Flush(){
+	uint8_t dummy;
+	while(UCSR0A & (1<<RXC0)){
+		dummy = UDR0;
+	}
+	(void)dummy;
+}
+
+//Writes the byte into the device and returns the byte clocked back
+uint8_t MSPIM_Transfer(uint8_t byte){
+	//Wait for the transmit buffer to empty
+	while(!(UCSR0A & (1<<UDRE0)));
+	UDR0 = byte;
+	//Wait until the byte has been shifted in
+	while(!(UCSR0A & (1<<RXC0)));
+	//Return the data in the register
+	return UDR0;
+}
+
+//Stream a block out, the double buffer is refilled while the previous byte is still shifting
+void MSPIM_Write(const uint8_t *buffer, uint8_t length){
+	uint8_t i;
+	uint8_t dummy;
+	//Clear the transmit complete flag so the end of the block can be detected
+	UCSR0A = (1<<TXC0);
+	for(i=0; i<length; i++){
+		while(!(UCSR0A & (1<<UDRE0)));
+		UDR0 = buffer[i];
+		//Drop the received byte before the receive buffer overruns
+		if(UCSR0A & (1<<RXC0)){
+			dummy = UDR0;
+		}
+	}
+	//Wait for the last byte to leave the shift register
+	while(!(UCSR0A & (1<<TXC0)));
+	(void)dummy;
+	MSPIM_Flush();
+}
+
+//Stream a block in by clocking out the fill byte with no gap between bytes
+void MSPIM_Read(uint8_t *buffer, uint8_t length, uint8_t fill){
+	uint8_t i;
+	if(length == 0){
+		return;
+	}
+	//Keep one byte queued ahead of the one being received
+	while(!(UCSR0A & (1<<UDRE0)));
+	UDR0 = fill;
+	for(i=0; i<length; i++){
+		if(i + 1 < length){
+			while(!(UCSR0A & (1<<UDRE0)));
+			UDR0 = fill;
+		}
+		while(!(UCSR0A & (1<<RXC0)));
+		buffer[i] = UDR0;
+	}
+}
+
+/******************** Interrupt Service Routines *********/
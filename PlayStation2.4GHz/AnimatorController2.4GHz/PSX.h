@@ -58,10 +58,37 @@
 #define PORT_PSX PORTB
 #define BIT_SET(byte, bit) (byte & (1<<bit))
 
+//Define PSX_SOFTSPI to move the pad onto its own software bus so it never waits on the nRF for SPCR
+#ifdef PSX_SOFTSPI
+#ifndef SOFTSPI_PORT
+#define SOFTSPI_PORT PORTD
+#define SOFTSPI_DDR DDRD
+#define SOFTSPI_PIN PIND
+#define SOFTSPI_SS PD5 //ATT
+#define SOFTSPI_MOSI PD6 //CMD
+#define SOFTSPI_MISO PD7 //DATA
+#define SOFTSPI_SCK PD3 //CLK
+#endif
+#define SOFTSPI_MODE 3 //Mode 1:1
+#define SOFTSPI_LSB_FIRST
+#define PSX_BUS_INIT() SoftSPI_init()
+#define PSX_SELECT() SoftSPI_Enable()
+#define PSX_TRANSFER(byte) SoftSPI_Transfer(byte)
+#define PSX_RELEASE() SoftSPI_Disable()
+#else
+#define PSX_BUS_INIT() SPIBus_init()
+#define PSX_SELECT() SPIBus_Select(SPIBUS_PSX)
+#define PSX_TRANSFER(byte) SPIBus_Transfer(byte)
+#define PSX_RELEASE() SPIBus_Release()
+#endif
+
 /******************** Includes ***************************/
 
 #include <avr/io.h>
-#include "SPI.h"
+#ifdef PSX_SOFTSPI
+#include "SoftSPI.h"
+#endif
+#include "SPIBus.h"
 
 /******************* Globals *****************************/
 
@@ -83,38 +110,38 @@ void PSX_init(){
 	DDR_PSX |= (0<<ACK);
 	//Set the default values for outputs to zero and inputs to have pull-up resistors
 	PORT_PSX |= (1<<ACK);
-	//Initialize the SPI Connection
-	SPI_init();
+	//Initialize the SPI Connection (shared hardware bus or the pad's own software bus)
+	PSX_BUS_INIT();
 	return; //Return to call point
 }
 
 //Writes the byte into the device
 uint8_t PSX_Read(PSXControllerStatus *controller){
 	//Wake up the controller with the ATT (Attention Line)
-	SPI_Enable();
+	PSX_SELECT();
 	//Send 0x01 to receive the controller ID
-	SPI_Transfer(0x01);
+	PSX_TRANSFER(0x01);
 	_delay_us(ATT_DELAY_US);
 	//Transfer returns controller ID
 	//Send 0x42 and if we received a 0x5A, the controller is ready for send data
-	controller->id = SPI_Transfer(0x42);
+	controller->id = PSX_TRANSFER(0x42);
 	_delay_us(ATT_DELAY_US);
-	SPI_Transfer(0x00);
+	PSX_TRANSFER(0x00);
 	_delay_us(ATT_DELAY_US);
 	//Data is ready and sending the two bytes for button status
-	uint8_t upper = ~SPI_Transfer(0xFF); //First Byte
+	uint8_t upper = ~PSX_TRANSFER(0xFF); //First Byte
 	_delay_us(ATT_DELAY_US);
-	controller->buttons = (uint16_t)(upper << 8) | (~SPI_Transfer(0xFF) & 0xFF);
+	controller->buttons = (uint16_t)(upper << 8) | (~PSX_TRANSFER(0xFF) & 0xFF);
 	_delay_us(ATT_DELAY_US);
-	controller->joyrx = ~SPI_Transfer(0xFF);
+	controller->joyrx = ~PSX_TRANSFER(0xFF);
 	_delay_us(ATT_DELAY_US);
-	controller->joyry = ~SPI_Transfer(0xFF);
+	controller->joyry = ~PSX_TRANSFER(0xFF);
 	_delay_us(ATT_DELAY_US);
-	controller->joylx = ~SPI_Transfer(0xFF);
+	controller->joylx = ~PSX_TRANSFER(0xFF);
 	_delay_us(ATT_DELAY_US);
-	controller->joyly = ~SPI_Transfer(0xFF);
+	controller->joyly = ~PSX_TRANSFER(0xFF);
 	_delay_us(ATT_DELAY_US);
-	SPI_Disable();
+	PSX_RELEASE();
 	//Buttons are active low but inverted to appear as active high
 	//Return 1 to indicate success
 	return 1;
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+//
+//  SPIBus.h
+//
+//  Swallowtail SPI Bus Arbiter Firmware
+//  AVR (ATmega168PB) Shared SPI Bus Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+#ifndef SPIBUS_H
+#define SPIBUS_H
+
+/******************** Macros *****************************/
+
+//Devices sharing the hardware SPI
+#define SPIBUS_PSX 0 //PlayStation controller (LSB first, Mode 1:1)
+#define SPIBUS_NRF 1 //nRF24L01 radio (MSB first, Mode 0:0)
+#define SPIBUS_DEVICES 2
+#define SPIBUS_NONE 0xFF //Nobody owns the bus
+
+//Transaction flags
+#define SPIBUS_WRITE 0x00 //Clock the buffer out, discard what comes back
+#define SPIBUS_READ 0x01 //Clock out NOPs, store what comes back in the buffer
+
+#define SPIBUS_QUEUE_SIZE 4 //Pending transactions (must be a power of two)
+#define SPIBUS_FILL 0xFF //Byte sent while reading
+
+//Collect per device bus utilization using Timer1 (1 tick = 1 CPU cycle)
+#define SPIBUS_STATS
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "SPI.h"
+
+/******************* Globals *****************************/
+
+//SPI configuration owned by each device
+typedef struct SPIBusDevice {
+	uint8_t spcr; //SPI control register value used while the device is selected
+	volatile uint8_t *cs_port; //Port register of the chip select line
+	uint8_t cs_mask; //Chip select bit (active low)
+} SPIBusDevice;
+
+//A transaction waiting for the bus
+typedef struct SPIBusTransaction {
+	uint8_t device; //Device the transaction is addressed to
+	uint8_t command; //First byte clocked out after chip select
+	uint8_t *buffer; //Data to send or space for the reply (must stay valid until serviced)
+	uint8_t length; //Number of bytes after the command
+	uint8_t flags; //SPIBUS_WRITE or SPIBUS_READ
+} SPIBusTransaction;
+
+//Bus usage counters for one device
+typedef struct SPIBusStats {
+	uint32_t busy_ticks; //Timer1 ticks the device held chip select
+	uint16_t transactions; //Number of select/release pairs
+	uint16_t bytes; //Bytes clocked while selected
+	uint16_t reconfigs; //Times SPCR actually had to be rewritten for this device
+} SPIBusStats;
+
+static const SPIBusDevice spibus_devices[SPIBUS_DEVICES] = {
+	//PSX: LSB first, Mode 1:1, f/16, ATT on the hardware SS line
+	{ (1<<SPE) | (1<<DORD) | (1<<MSTR) | (1<<CPOL) | (1<<CPHA) | (0<<SPR1) | (1<<SPR0), &PORTB, (1<<PB2) },
+	//nRF24L01: MSB first, Mode 0:0, f/16, CSN on PC0
+	{ (1<<SPE) | (0<<DORD) | (1<<MSTR) | (0<<CPOL) | (0<<CPHA) | (0<<SPR1) | (1<<SPR0), &PORTC, (1<<PC0) }
+};
+
+static volatile uint8_t spibus_spcr; //Last value written to SPCR (skip redundant writes, also written from the poll ISR)
+static volatile uint8_t spibus_owner = SPIBUS_NONE; //Device currently holding chip select
+static SPIBusTransaction spibus_queue[SPIBUS_QUEUE_SIZE];
+static volatile uint8_t spibus_head; //Next slot to fill
+static volatile uint8_t spibus_tail; //Next slot to service
+
+#ifdef SPIBUS_STATS
+static SPIBusStats spibus_stats[SPIBUS_DEVICES];
+static volatile uint16_t spibus_overflows; //Timer1 overflows since the stats were reset
+static uint16_t spibus_select_tick; //TCNT1 when chip select was asserted
+#endif
+
+/******************** Functions **************************/
+
+//Initialize the hardware SPI and the arbiter state
+void SPIBus_init(){
+	SPI_init();
+	//SPI_init leaves the bus in the PSX configuration
+	SPCR = spibus_devices[SPIBUS_PSX].spcr;
+	spibus_spcr = SPCR;
+	spibus_owner = SPIBUS_NONE;
+#ifdef SPIBUS_STATS
+	//Timer1 free running at the CPU clock
+	TCCR1A = 0x00;
+	TCCR1B = (1<<CS10);
+	TIMSK1 |= (1<<TOIE1);
+#endif
+	return; //Return to call point
+}
+
+//Returns 1 if a device currently holds the bus
+uint8_t SPIBus_Busy(){
+	return spibus_owner != SPIBUS_NONE;
+}
+
+//Take the bus for a device: reconfigure SPCR only if needed, then assert chip select
+void SPIBus_Select(uint8_t device){
+	const SPIBusDevice *dev = &spibus_devices[device];
+	//Claim the bus first so a poll ISR sees it busy before SPCR is touched (spibus_spcr is volatile, so its read cannot move above this store)
+	spibus_owner = device;
+	//SPCR must change before chip select drops so the clock idles at the right level
+	if(spibus_spcr != dev->spcr){
+		SPCR = dev->spcr;
+		spibus_spcr = dev->spcr;
+#ifdef SPIBUS_STATS
+		spibus_stats[device].reconfigs++;
+#endif
+	}
+#ifdef SPIBUS_STATS
+	spibus_select_tick = TCNT1;
+#endif
+	*dev->cs_port &= ~dev->cs_mask;
+}
+
+//Give the bus back by releasing chip select (SPCR is left as is)
+void SPIBus_Release(){
+	uint8_t device = spibus_owner;
+	if(device == SPIBUS_NONE){
+		return;
+	}
+	const SPIBusDevice *dev = &spibus_devices[device];
+	*dev->cs_port |= dev->cs_mask;
+#ifdef SPIBUS_STATS
+	spibus_stats[device].busy_ticks += (uint16_t)(TCNT1 - spibus_select_tick);
+	spibus_stats[device].transactions++;
+#endif
+	spibus_owner = SPIBUS_NONE;
+}
+
+//Transfer one byte for the device holding the bus
+uint8_t SPIBus_Transfer(uint8_t byte){
+#ifdef SPIBUS_STATS
+	if(spibus_owner != SPIBUS_NONE){
+		spibus_stats[spibus_owner].bytes++;
+	}
+#endif
+	return SPI_Transfer(byte);
+}
+
+//Schedule a transaction to run on the next SPIBus_Service (returns 0 if the queue is full)
+uint8_t SPIBus_Queue(uint8_t device, uint8_t command, uint8_t *buffer, uint8_t length, uint8_t flags){
+	uint8_t next = (spibus_head + 1) & (SPIBUS_QUEUE_SIZE - 1);
+	if(next == spibus_tail){
+		return 0; //Queue full
+	}
+	SPIBusTransaction *t = &spibus_queue[spibus_head];
+	t->device = device;
+	t->command = command;
+	t->buffer = buffer;
+	t->length = length;
+	t->flags = flags;
+	spibus_head = next;
+	return 1;
+}
+
+//Number of transactions waiting for the bus
+uint8_t SPIBus_Pending(){
+	return (spibus_head - spibus_tail) & (SPIBUS_QUEUE_SIZE - 1);
+}
+
+//Run every queued transaction back to back (call between PSX polls)
+void SPIBus_Service(){
+	while(spibus_tail != spibus_head){
+		SPIBusTransaction *t = &spibus_queue[spibus_tail];
+		uint8_t i;
+		SPIBus_Select(t->device);
+		SPIBus_Transfer(t->command);
+		for(i=0; i<t->length; i++){
+			if(t->flags & SPIBUS_READ){
+				t->buffer[i] = SPIBus_Transfer(SPIBUS_FILL);
+			}
+			else{
+				SPIBus_Transfer(t->buffer[i]);
+			}
+		}
+		SPIBus_Release();
+		spibus_tail = (spibus_tail + 1) & (SPIBUS_QUEUE_SIZE - 1);
+	}
+}
+
+#ifdef SPIBUS_STATS
+//Timer1 ticks elapsed since the stats were last reset
+uint32_t SPIBus_Elapsed(){
+	uint16_t overflows, ticks;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+		overflows = spibus_overflows;
+		ticks = TCNT1;
+		//Account for an overflow that is pending but not yet serviced
+		if((TIFR1 & (1<<TOV1)) && ticks < 0x8000){
+			overflows++;
+		}
+	}
+	return ((uint32_t)overflows << 16) | ticks;
+}
+
+//Bus utilization of a device in tenths of a percent since the last reset
+uint16_t SPIBus_Utilization(uint8_t device){
+	uint32_t elapsed = SPIBus_Elapsed();
+	if(elapsed == 0){
+		return 0;
+	}
+	return (uint16_t)((spibus_stats[device].busy_ticks * 1000UL) / elapsed);
+}
+
+//Read back the raw counters of a device
+const SPIBusStats *SPIBus_Stats(uint8_t device){
+	return &spibus_stats[device];
+}
+
+//Start a new measurement window
+void SPIBus_ResetStats(){
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE){
+		uint8_t i;
+		for(i=0; i<SPIBUS_DEVICES; i++){
+			spibus_stats[i].busy_ticks = 0;
+			spibus_stats[i].transactions = 0;
+			spibus_stats[i].bytes = 0;
+			spibus_stats[i].reconfigs = 0;
+		}
+		TCNT1 = 0;
+		TIFR1 = (1<<TOV1);
+		spibus_overflows = 0;
+	}
+}
+#endif
+
+/******************** Interrupt Service Routines *********/
+
+#ifdef SPIBUS_STATS
+//Extend Timer1 for the utilization window
+ISR(TIMER1_OVF_vect){
+	spibus_overflows++;
+}
+#endif
+
+#endif
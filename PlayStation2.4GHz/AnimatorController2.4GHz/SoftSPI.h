@@ -31,76 +31,124 @@
 //
 //-----------------------------------------------------------------------------
 
+#ifndef SOFTSPI_H
+#define SOFTSPI_H
+
 /******************** Macros *****************************/
 
-#define SS PB2
-#define MOSI PB3
-#define MISO PB4
-#define SCK PB5
-#define DDR_SPI DDRB
-#define PORT_SPI PORTB
-#define PIN_SPI PINB
+//Pin selection (override before including to move the bus, all four pins must share one port)
+#ifndef SOFTSPI_PORT
+#define SOFTSPI_PORT PORTB
+#define SOFTSPI_DDR DDRB
+#define SOFTSPI_PIN PINB
+#define SOFTSPI_SS PB2
+#define SOFTSPI_MOSI PB3
+#define SOFTSPI_MISO PB4
+#define SOFTSPI_SCK PB5
+#endif
+
+//SPI mode 0-3 (bit 1 = CPOL, bit 0 = CPHA)
+#ifndef SOFTSPI_MODE
+#define SOFTSPI_MODE 0
+#endif
+
+//Define SOFTSPI_LSB_FIRST before including to shift the least significant bit first
+
+//Target SCK frequency, the bus runs at the closest rate the CPU clock allows
+#ifndef SOFTSPI_CLOCK_HZ
+#define SOFTSPI_CLOCK_HZ 250000UL
+#endif
+
+#define SOFTSPI_BIT_CYCLES 11 //Cycles per bit with no padding (5 data + 2 + 2 edges + 2 sample)
+#define SOFTSPI_DELAY_CYCLES ((F_CPU / SOFTSPI_CLOCK_HZ) > SOFTSPI_BIT_CYCLES ? ((F_CPU / SOFTSPI_CLOCK_HZ) - SOFTSPI_BIT_CYCLES) / 2 : 0) //Padding per half clock
+#define SOFTSPI_ACTUAL_HZ (F_CPU / (SOFTSPI_BIT_CYCLES + 2 * SOFTSPI_DELAY_CYCLES)) //Rate the bus really runs at
+
 #define BIT_SET(byte, bit) (byte & (1<<bit))
-#define CLOCK_PER 16 //The period of the clock in micro-seconds
-#define HOLD_TIME 1 //Hold for 2us between software transactions
+
+//Clock edges (leading edge leaves the idle level)
+#if SOFTSPI_MODE & 0x02
+#define SOFTSPI_LEAD		"	cbi %[port], %[sck]\n"
+#define SOFTSPI_TRAIL		"	sbi %[port], %[sck]\n"
+#else
+#define SOFTSPI_LEAD		"	sbi %[port], %[sck]\n"
+#define SOFTSPI_TRAIL		"	cbi %[port], %[sck]\n"
+#endif
+
+//Put bit n of the output byte on MOSI (5 cycles whatever the value)
+#define SOFTSPI_PUT(n)		"	sbrc %[out], " #n "\n	sbi %[port], %[mosi]\n	sbrs %[out], " #n "\n	cbi %[port], %[mosi]\n"
+//Store MISO into bit n of the input byte (2 cycles whatever the value)
+#define SOFTSPI_GET(n)		"	sbic %[pin], %[miso]\n	ori %[in], (1<<" #n ")\n"
+//Padding between edges
+#define SOFTSPI_DELAY		"	.rept %[dly]\n	nop\n	.endr\n"
+
+#if SOFTSPI_MODE & 0x01
+//CPHA 1: data changes on the leading edge and is sampled on the trailing edge
+#define SOFTSPI_BIT(n)		SOFTSPI_LEAD SOFTSPI_PUT(n) SOFTSPI_DELAY SOFTSPI_TRAIL SOFTSPI_GET(n) SOFTSPI_DELAY
+#else
+//CPHA 0: data is set up before the leading edge and sampled on it
+#define SOFTSPI_BIT(n)		SOFTSPI_PUT(n) SOFTSPI_DELAY SOFTSPI_LEAD SOFTSPI_GET(n) SOFTSPI_DELAY SOFTSPI_TRAIL
+#endif
+
+#ifdef SOFTSPI_LSB_FIRST
+#define SOFTSPI_BYTE		SOFTSPI_BIT(0) SOFTSPI_BIT(1) SOFTSPI_BIT(2) SOFTSPI_BIT(3) SOFTSPI_BIT(4) SOFTSPI_BIT(5) SOFTSPI_BIT(6) SOFTSPI_BIT(7)
+#else
+#define SOFTSPI_BYTE		SOFTSPI_BIT(7) SOFTSPI_BIT(6) SOFTSPI_BIT(5) SOFTSPI_BIT(4) SOFTSPI_BIT(3) SOFTSPI_BIT(2) SOFTSPI_BIT(1) SOFTSPI_BIT(0)
+#endif
 
 /******************** Includes ***************************/
 
 #include <avr/io.h>
-#include <util/delay.h>
 
 /******************* Globals *****************************/
 
 
 /******************** Functions **************************/
 
-//Initialize the USI on the ATmega168/328 for Three-Wire Operation
-void SPI_init(){
+//Initialize the pins of the software bus (independent of the hardware SPI)
+void SoftSPI_init(){
 	//Initialize the output for SPI Master Mode
-	DDR_SPI |= (1<<SS)|(1<<MOSI)|(0<<MISO)|(1<<SCK); //SS | MOSI | MISO | SCK
-	//Set the default values for outputs to zero and inputs to have pull-up resistors
-	PORT_SPI |= (0<<SS)|(0<<MOSI)|(1<<MISO)|(0<<SCK); //SS | MOSI | MISO | SCK
+	SOFTSPI_DDR |= (1<<SOFTSPI_SS)|(1<<SOFTSPI_MOSI)|(1<<SOFTSPI_SCK);
+	SOFTSPI_DDR &= ~(1<<SOFTSPI_MISO);
+	//Slave deselected, pull-up on MISO (open collector devices such as the PSX pad)
+	SOFTSPI_PORT |= (1<<SOFTSPI_SS)|(1<<SOFTSPI_MISO);
+	//Clock rests at the idle level of the selected mode
+#if SOFTSPI_MODE & 0x02
+	SOFTSPI_PORT |= (1<<SOFTSPI_SCK);
+#else
+	SOFTSPI_PORT &= ~(1<<SOFTSPI_SCK);
+#endif
 	return; //Return to call point
 }
 
 //Enable the slave select line
-void SPI_Enable(){
+void SoftSPI_Enable(){
 	//Enable SS Line
-	PORT_SPI &= ~(1<<SS);
+	SOFTSPI_PORT &= ~(1<<SOFTSPI_SS);
 }
 
-//Enable the slave select line
-void SPI_Disable(){
+//Disable the slave select line
+void SoftSPI_Disable(){
 	//Disable SS Line
-	PORT_SPI |= (1<<SS);
+	SOFTSPI_PORT |= (1<<SOFTSPI_SS);
 }
 
-//Writes the byte into the device and receives byte back using software
-uint8_t SPI_Transfer(uint8_t byte){
-	// The clock is held high until a byte is to be sent.
-	uint8_t out = 0x00;
-	uint8_t i = 0;
-	for (i = 0; i < 8; i++){
-		// When the clock edge drops low, the values on the line start to change
-		PORT_SPI &= ~(1<<SCK);
-		_delay_us(HOLD_TIME);
-		//Get bit i from byte
-		if(((byte & ( 1 << i )) >> i)){
-			PORT_SPI |= (1<<MOSI);
-		}
-		else{
-			PORT_SPI &= ~(1<<MOSI);
-		}
-		_delay_us(CLOCK_PER / 2 - HOLD_TIME);
-		// When the clock goes from low to high, value are actually read
-		PORT_SPI |= (1<<SCK);
-		_delay_us(HOLD_TIME);
-		if((PIN_SPI & (1<<MISO))){
-			out |= (1<<i);
-		}
-		_delay_us(CLOCK_PER / 2 - HOLD_TIME);
-	}
-	return out;
+//Writes the byte into the device and receives a byte back (unrolled, every bit takes the same number of cycles)
+uint8_t SoftSPI_Transfer(uint8_t byte){
+	uint8_t in = 0x00;
+	asm volatile(
+		SOFTSPI_BYTE
+		: [in] "+d" (in)
+		: [out] "r" (byte),
+		  [port] "I" (_SFR_IO_ADDR(SOFTSPI_PORT)),
+		  [pin] "I" (_SFR_IO_ADDR(SOFTSPI_PIN)),
+		  [sck] "I" (SOFTSPI_SCK),
+		  [mosi] "I" (SOFTSPI_MOSI),
+		  [miso] "I" (SOFTSPI_MISO),
+		  [dly] "n" (SOFTSPI_DELAY_CYCLES)
+	);
+	return in;
 }
 
 /******************** Interrupt Service Routines *********/
+
+#endif
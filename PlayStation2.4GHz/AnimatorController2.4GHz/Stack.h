@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+//
+//  Stack.h
+//
+//  Swallowtail Stack Monitor Firmware
+//  AVR (ATmega168PB) Stack High-Water Mark Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+/******************** Macros *****************************/
+
+#define STACK_CANARY 0xC5 //Painted over the free SRAM at reset, anything else was written by the stack since
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <avr/io.h>
+
+/******************* Globals *****************************/
+
+//Linker symbols: end of the static RAM (.data, .bss and .noinit) and top of the stack
+extern uint8_t _end;
+extern uint8_t __stack;
+
+static uint16_t stack_unused_min = 0xFFFF; //Least free SRAM seen by Stack_Scan
+
+/******************** Functions **************************/
+
+//Paint everything between the static RAM and the top of the stack before anything runs (.init1 comes before the stack
+//pointer and r1 are set up, so no C and no calls here). Nothing to call, it runs by itself at reset
+void Stack_Paint(void) __attribute__((naked, used, section(".init1")));
+void Stack_Paint(void){
+	asm volatile(
+		"	ldi r30, lo8(_end)		\n"
+		"	ldi r31, hi8(_end)		\n"
+		"	ldi r24, %0				\n"
+		"	ldi r25, hi8(__stack)	\n"
+		"	rjmp 2f					\n"
+		"1:	st Z+, r24				\n"
+		"2:	cpi r30, lo8(__stack)	\n"
+		"	cpc r31, r25			\n"
+		"	brlo 1b					\n"
+		"	breq 1b					\n"
+		:
+		: "M" (STACK_CANARY));
+}
+
+//Static RAM used by the firmware (.data, .bss and .noinit)
+uint16_t Stack_Static(){
+	return &_end - (uint8_t *)RAMSTART;
+}
+
+//SRAM free right now (between the static RAM and the stack pointer)
+uint16_t Stack_Free(){
+	return (uint8_t *)SP - &_end;
+}
+
+//Scan up from the static RAM for the first byte the stack ever reached. Returns the worst case free SRAM since reset
+//(costs about 5 cycles per free byte, run it from the main loop now and then, not from an ISR)
+uint16_t Stack_Scan(){
+	const uint8_t *p = &_end;
+	while(p <= &__stack && *p == STACK_CANARY){
+		p++;
+	}
+	uint16_t unused = p - &_end;
+	if(unused < stack_unused_min){
+		stack_unused_min = unused;
+	}
+	return unused;
+}
+
+//Deepest the stack has been (as of the last Stack_Scan)
+uint16_t Stack_HighWater(){
+	if(stack_unused_min == 0xFFFF){
+		return 0; //Not scanned yet
+	}
+	return &__stack - &_end + 1 - stack_unused_min;
+}
+
+//Worst case free SRAM as of the last Stack_Scan
+uint16_t Stack_Unused(){
+	return stack_unused_min;
+}
+
+/******************** Interrupt Service Routines *********/
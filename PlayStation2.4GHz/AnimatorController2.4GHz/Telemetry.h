@@ -0,0 +1,249 @@
+//-----------------------------------------------------------------------------
+//
+//  Telemetry.h
+//
+//  Swallowtail Link Telemetry Firmware
+//  AVR (ATmega168PB) Radio Link Telemetry Firmware
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/******************** Macros *****************************/
+
+#define TELEMETRY_BAUD 9600 //Fastest standard rate with a clean divisor at 1MHz (U2X, 0.2% off)
+#define TELEMETRY_RECORDS 16 //Packets waiting for the UART (must be a power of two, one slot stays empty)
+#define TELEMETRY_SUMMARY_PACKETS 64 //Packets between two counter frames
+
+//Framing shared with the host tools (same as the adapter's Serial.h): sync, type, length (little endian), payload,
+//CRC-16/CCITT of everything after the sync
+#define TELEMETRY_SYNC0 0xA5
+#define TELEMETRY_SYNC1 0x5A
+#define TELEMETRY_HEADER_SIZE 5 //Sync, type and length
+#define TELEMETRY_CRC_INIT 0xFFFF
+
+//Frame types (0x01 is a Maple capture on the adapter)
+#define TELEMETRY_TYPE_PACKET 0x02 //One TelemetryRecord
+#define TELEMETRY_TYPE_SUMMARY 0x03 //TelemetrySummary
+
+//Payload sizes, the host reads the fields at these offsets (little endian)
+#define TELEMETRY_RECORD_SIZE 8
+#define TELEMETRY_SUMMARY_SIZE 16
+
+//TelemetryRecord flags
+#define TELEMETRY_MAX_RT 0x01 //The packet was given up after all retries (the nRF was reset)
+
+//Keep the compiler from moving the record and summary stores past the volatile flags that hand them to the ISR
+#define TELEMETRY_BARRIER() asm volatile("" ::: "memory")
+
+#define BIT_SET(byte, bit) (byte & (1<<bit))
+
+/******************** Includes ***************************/
+
+#include <stdint.h>
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "UART.h" //nRF24L01.h and Stack.h have to be included first
+#endif
+
+/******************* Globals *****************************/
+
+//One packet as the transmitter saw it
+typedef struct TelemetryRecord {
+	uint16_t seq; //Packet number since reset
+	uint8_t arc; //Retransmissions it took (ARC_CNT)
+	uint8_t plos; //Packets lost on this channel (PLOS_CNT, stops at 15 until RF_CH is written)
+	uint8_t flags; //TELEMETRY_MAX_RT
+	uint8_t channel; //RF_CH the packet went out on
+	uint16_t loop_ms; //Time since the previous packet
+} TelemetryRecord;
+
+//Counters since reset
+typedef struct TelemetrySummary {
+	uint32_t packets; //Packets sent
+	uint32_t retries; //Sum of ARC_CNT over all packets
+	uint16_t max_rt; //Packets given up
+	uint16_t dropped; //Records that found the ring full (the counters still have them)
+	uint16_t loop_max; //Longest time between two packets (ms)
+	uint16_t stack_unused; //Worst case free SRAM (Stack_Unused)
+} TelemetrySummary;
+
+#ifdef __AVR__
+_Static_assert(sizeof(TelemetryRecord) == TELEMETRY_RECORD_SIZE, "TelemetryRecord does not match TELEMETRY_RECORD_SIZE");
+_Static_assert(sizeof(TelemetrySummary) == TELEMETRY_SUMMARY_SIZE, "TelemetrySummary does not match TELEMETRY_SUMMARY_SIZE");
+
+static TelemetryRecord telemetry_ring[TELEMETRY_RECORDS];
+static volatile uint8_t telemetry_head; //Next slot to fill (main loop)
+static volatile uint8_t telemetry_tail; //Slot being sent (UART ISR)
+static TelemetrySummary telemetry_summary; //Counters kept by the main loop
+static TelemetrySummary telemetry_summary_tx; //Copy the ISR sends from, so the frame never tears
+static volatile uint8_t telemetry_summary_ready; //Set while telemetry_summary_tx waits for the UART
+static uint16_t telemetry_seq;
+#endif
+
+/******************** Functions **************************/
+
+//Fold one byte into a CRC-16/CCITT (polynomial 0x1021, no reflection), same as the host side
+static inline uint16_t Telemetry_CRC(uint16_t crc, uint8_t byte){
+	uint8_t i;
+	crc ^= (uint16_t)byte << 8;
+	for(i=0; i<8; i++){
+		crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+	}
+	return crc;
+}
+
+#ifdef __AVR__
+#ifdef nRF24L01_MSPIM
+#error "Telemetry needs USART0, which nRF24L01_MSPIM gives to the radio"
+#endif
+
+//Start the UART, frames go out of PD1 from the UDRE interrupt
+void Telemetry_init(){
+	USART_init(TELEMETRY_BAUD);
+	return; //Return to call point
+}
+
+//Log one packet: ARC_CNT and PLOS_CNT as read from OBSERVE_TX, STATUS after the send, RF_CH and the loop time.
+//Never waits for the UART, a record that finds the ring full is only counted
+void Telemetry_Packet(uint8_t observe, uint8_t status, uint8_t channel, uint16_t loop_ms){
+	TelemetryRecord *record;
+	uint8_t next = (telemetry_head + 1) & (TELEMETRY_RECORDS - 1);
+	
+	//Counters first, they see every packet
+	telemetry_summary.packets++;
+	telemetry_summary.retries += observe & 0x0F;
+	if(BIT_SET(status, MAX_RT)){
+		telemetry_summary.max_rt++;
+	}
+	if(loop_ms > telemetry_summary.loop_max){
+		telemetry_summary.loop_max = loop_ms;
+	}
+	
+	if(next == telemetry_tail){
+		telemetry_summary.dropped++;
+	}
+	else{
+		record = &telemetry_ring[telemetry_head];
+		record->seq = telemetry_seq;
+		record->arc = observe & 0x0F;
+		record->plos = observe >> 4;
+		record->flags = BIT_SET(status, MAX_RT) ? TELEMETRY_MAX_RT : 0;
+		record->channel = channel;
+		record->loop_ms = loop_ms;
+		TELEMETRY_BARRIER();
+		telemetry_head = next;
+	}
+	telemetry_seq++;
+	
+	//Hand a copy of the counters to the ISR now and then (skip a turn if the last copy has not gone out yet)
+	if((telemetry_seq % TELEMETRY_SUMMARY_PACKETS) == 0 && !telemetry_summary_ready){
+		//The scan walks all the free SRAM, at 1MHz it is only worth doing when the result goes out
+		Stack_Scan();
+		telemetry_summary.stack_unused = Stack_Unused();
+		telemetry_summary_tx = telemetry_summary;
+		TELEMETRY_BARRIER();
+		telemetry_summary_ready = 1;
+	}
+	//Wake the transmitter up, it goes back to sleep once everything is out
+	UCSR0B |= (1<<UDRIE0);
+	return; //Return to call point
+}
+#endif
+
+/******************** Interrupt Service Routines *********/
+
+#ifdef __AVR__
+//Send the next byte of the frame, one byte per interrupt (about 150 cycles with the CRC step)
+ISR(USART_UDRE_vect){
+	static const uint8_t *payload; //Record or summary being sent
+	static uint8_t length;
+	static uint8_t type;
+	static uint8_t position; //Next byte of the frame, 0 when between frames
+	static uint16_t crc;
+	uint8_t byte;
+	
+	if(position == 0){
+		//Counters go first, they only come every TELEMETRY_SUMMARY_PACKETS packets
+		if(telemetry_summary_ready){
+			type = TELEMETRY_TYPE_SUMMARY;
+			payload = (const uint8_t *)&telemetry_summary_tx;
+			length = TELEMETRY_SUMMARY_SIZE;
+		}
+		else if(telemetry_tail != telemetry_head){
+			type = TELEMETRY_TYPE_PACKET;
+			payload = (const uint8_t *)&telemetry_ring[telemetry_tail];
+			length = TELEMETRY_RECORD_SIZE;
+		}
+		else{
+			//Nothing left to send, Telemetry_Packet turns the interrupt back on
+			UCSR0B &= ~(1<<UDRIE0);
+			return;
+		}
+	}
+	
+	if(position == 0){
+		byte = TELEMETRY_SYNC0;
+	}
+	else if(position == 1){
+		byte = TELEMETRY_SYNC1;
+	}
+	else if(position == 2){
+		byte = type;
+		crc = Telemetry_CRC(TELEMETRY_CRC_INIT, byte);
+	}
+	else if(position < TELEMETRY_HEADER_SIZE){
+		byte = (position == 3) ? length : 0; //Length, little endian
+		crc = Telemetry_CRC(crc, byte);
+	}
+	else if(position < TELEMETRY_HEADER_SIZE + length){
+		byte = payload[position - TELEMETRY_HEADER_SIZE];
+		crc = Telemetry_CRC(crc, byte);
+	}
+	else if(position == TELEMETRY_HEADER_SIZE + length){
+		byte = crc & 0xFF;
+	}
+	else{
+		//Last byte: the slot can be reused once its CRC is on the way
+		byte = crc >> 8;
+		if(type == TELEMETRY_TYPE_SUMMARY){
+			telemetry_summary_ready = 0;
+		}
+		else{
+			telemetry_tail = (telemetry_tail + 1) & (TELEMETRY_RECORDS - 1);
+		}
+		UDR0 = byte;
+		position = 0;
+		return;
+	}
+	UDR0 = byte;
+	position++;
+}
+#endif
+
+#endif
@@ -47,18 +47,19 @@
 void USART_init(uint16_t baud){
 	/*
 		Pin Descriptions:
-		PD0: Used for USART TX: Output (1)
-		PD1: Used for USART RX: Input (0)
+		PD0: Used for USART RX: Input (0)
+		PD1: Used for USART TX: Output (1)
 	*/
-	DDRD |= (1<<PD0) | (0<<PD1);
+	DDRD |= (0<<PD0) | (1<<PD1);
 	//Set the default values for outputs to zero and inputs to have pull-up resistors
-	PORTD |= (0<<PD0) | (1<<PD1);
-	//Set the baud rate
-	uint16_t UBBR = (uint16_t) ((F_CPU / (baud * 16UL)) - 1);
+	PORTD |= (1<<PD0) | (0<<PD1);
+	//Set the baud rate (double speed, at 1MHz x16 has no usable divisor above 4800 baud)
+	UCSR0A = (1<<U2X0);
+	uint16_t UBBR = (uint16_t) (((F_CPU + baud * 4UL) / (baud * 8UL)) - 1);
 	UBRR0H = (uint8_t)(UBBR>>8);
 	UBRR0L = (uint8_t)UBBR;
-	//Enable the receiver with interrupts
-	UCSR0B = (1<<RXEN0) | (1<<RXCIE0);
+	//Enable the receiver and the transmitter (poll the receiver, there is no receive ISR to jump to)
+	UCSR0B = (1<<RXEN0) | (1<<TXEN0);
 	//Set-up the frame format for the USART communication (8-bits 1 stop bit Parity Disabled)
 	UCSR0C = (0<<USBS0) | (3<<UCSZ00);
 	return; //Go back to previous location
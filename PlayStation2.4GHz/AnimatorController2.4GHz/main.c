@@ -37,6 +37,9 @@
 
 #define BIT_SET(byte, bit) (byte & (1<<bit))
 
+#define PAD_POLL_HZ 100 //Rate the pad is sampled in the background
+#define PAD_POLL_TICKS ((F_CPU / 1024UL / PAD_POLL_HZ) - 1) //Timer0 compare value (clk/1024)
+
 /******************** Includes ***************************/
 #include <avr/io.h>
 #include <avr/interrupt.h>
@@ -52,12 +55,69 @@
 /******************* Local Includes **********************/
 #include "PSX.h"
 #include "nRF24L01.h"
+#include "Snapshot.h"
+#include "Stack.h"
+#include "Telemetry.h"
+
+//Newest pad state handed from the poll ISR to the radio loop
+static Snapshot pad_snapshot;
+//Polls skipped because the radio was holding the shared SPI
+static volatile uint16_t pad_polls_deferred;
+//Poll ticks since reset, the clock for the loop time
+static volatile uint16_t pad_polls;
 
 /******************** Functions **************************/
 
+//Start Timer0 to sample the pad in the background (CTC mode, clk/1024)
+void PadPoll_init(){
+	TCCR0A = (1<<WGM01);
+	TCCR0B = (1<<CS02) | (1<<CS00);
+	OCR0A = PAD_POLL_TICKS;
+	TIMSK0 |= (1<<OCIE0A);
+	return; //Return to call point
+}
+
+//Milliseconds since the last call, from the poll timer (1 count = 1024 CPU cycles)
+uint16_t PadPoll_Lap(){
+	static uint16_t last_polls;
+	static uint8_t last_count;
+	uint16_t polls;
+	uint8_t count;
+	uint32_t counts;
+	uint8_t sreg = SREG;
+	cli();
+	polls = pad_polls;
+	count = TCNT0;
+	//A compare match the ISR has not seen yet already restarted the count
+	if(TIFR0 & (1<<OCF0A)){
+		polls++;
+		count = TCNT0;
+	}
+	SREG = sreg;
+	counts = (uint32_t)(uint16_t)(polls - last_polls) * (PAD_POLL_TICKS + 1) + count - last_count;
+	last_polls = polls;
+	last_count = count;
+	counts = counts * 1024UL / (F_CPU / 1000UL);
+	return (counts > 0xFFFF) ? 0xFFFF : counts; //Return to call point
+}
 
 /********** Interrupt Service Routines *******************/
 
+//Sample the pad and publish it for the radio
+ISR(TIMER0_COMPA_vect){
+	static PSXControllerStatus sample;
+	pad_polls++;
+#ifndef PSX_SOFTSPI
+	//The radio owns the hardware SPI, try again on the next tick
+	if(SPIBus_Busy()){
+		pad_polls_deferred++;
+		return;
+	}
+#endif
+	PSX_Read(&sample);
+	Snapshot_Publish(&pad_snapshot, &sample, sizeof(sample));
+}
+
 
 /******************** Main *******************************/
 int main(void)
@@ -70,6 +130,9 @@ int main(void)
 	//Buffer for transmitting data
 	static uint8_t tx_buffer[5];
 	
+	//The pad state must fit in a snapshot slot
+	_Static_assert(sizeof(PSXControllerStatus) <= SNAPSHOT_SIZE, "PSXControllerStatus does not fit in a snapshot");
+	
 	//Initialize the debug output
 	DDRB |= (1<<PB0);
 	//Set the default values for outputs to zero and inputs to have pull-up resistors
@@ -79,6 +142,10 @@ int main(void)
 	PSX_init();
 	//Initialize the nRF24L01 Communications as a transmitter
 	nRF24L01_init(TX, rx_address, tx_address);
+	//Sample the pad in the background from here on
+	PadPoll_init();
+	//Stream the link telemetry out of the UART
+	Telemetry_init();
 	
 	//Set interrupts
 	sei();
@@ -86,9 +153,11 @@ int main(void)
 	/* State machine loop */
 	while (1)
 	{
-		//Get the current controller status
+		//Get the freshest complete controller status (wait for the poll ISR if nothing new)
 		static PSXControllerStatus controller;
-		PSX_Read(&controller);
+		if(!Snapshot_Take(&pad_snapshot, &controller, sizeof(controller))){
+			continue;
+		}
 		//Put controller data into the tx_buffer to be transmitted
 		tx_buffer[0] = ((uint16_t)controller.buttons >> 0) & 0xFF; //First byte of digital buttons
 		tx_buffer[1] = ((uint16_t)controller.buttons >> 8) & 0xFF; //Second byte of digital buttons
@@ -96,17 +165,24 @@ int main(void)
 		tx_buffer[3] = controller.joyly; //Left joystick for direction (Y-coord)
 		tx_buffer[4] = 0x00;
 		
-		//Transmit the controller data
-		nRF24L01_Transmit(tx_buffer);
+		//Load the payload on the shared bus now that the PSX poll is done, then transmit it
+		nRF24L01_QueuePayload(tx_buffer);
+		SPIBus_Service();
+		nRF24L01_Send();
 		
 		//TODO improve buffer overflow issue
 		//Check that the transmission was successful (If MAX_RT is 1 then the transmission failed)
-		if((nRF24L01_ReadRegister(STATUS) & (1<<MAX_RT)) != 0){
+		uint8_t status = nRF24L01_ReadRegister(STATUS);
+		//Retransmissions (ARC_CNT) and lost packets (PLOS_CNT) must be read before the reset
+		uint8_t observe = nRF24L01_ReadRegister(OBSERVE_TX);
+		if((status & (1<<MAX_RT)) != 0){
 			PORTB |= (1<<PB0);
 			//Reset the nRF
 			nRF24L01_Reset();
 			PORTB &= ~(1<<PB0);
 		}
+		//Log the packet for the link telemetry (the UART sends it in the background, the free SRAM is scanned once per counter frame)
+		Telemetry_Packet(observe, status, nRF24L01_ReadRegister(RF_CH), PadPoll_Lap());
 		_delay_ms(20);
 		
 	}
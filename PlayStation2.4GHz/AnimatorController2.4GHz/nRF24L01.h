@@ -126,10 +126,21 @@
 #define CSN PC0 //Chip Select
 #define IRQ PC2 //Mask-able interrupt (Active Low)
 
+//Define nRF24L01_MSPIM to put the radio on USART0 in master SPI mode and leave the hardware SPI to the pad
+#ifdef nRF24L01_MSPIM
+#define nRF24L01_TRANSFER(byte) MSPIM_Transfer(byte)
+#else
+#define nRF24L01_TRANSFER(byte) SPIBus_Transfer(byte)
+#endif
+
 /******************** Includes ***************************/
 
 #include <avr/io.h>
 #include <util/delay.h>
+#ifdef nRF24L01_MSPIM
+#include "MSPIM.h"
+#endif
+#include "SPIBus.h"
 
 /******************* Globals *****************************/
 
@@ -138,19 +149,24 @@
 
 //CSN enabled
 void nRF24L01_Enable(){
-	//Change the SPI Data Order to MSB first and change to Mode 0:0
-	SPCR &= ~((1<<DORD)|(1<<CPOL)|(1<<CPHA));
-	//CSN must be held low - nRF starts to listen for a command
-	PORT_nRF24L01 &= ~(1<<CSN); 
-	return;	
+#ifdef nRF24L01_MSPIM
+	//The radio has USART0 to itself - CSN must be held low and the nRF starts to listen for a command
+	PORT_nRF24L01 &= ~(1<<CSN);
+#else
+	//Take the shared bus (MSB first, Mode 0:0) - CSN is held low and the nRF starts to listen for a command
+	SPIBus_Select(SPIBUS_NRF);
+#endif
+	return;
 }
 
 //CSN disables
 void nRF24L01_Disable(){
 	//CSN must be held high - nRF is no longer listening
+#ifdef nRF24L01_MSPIM
 	PORT_nRF24L01 |= (1<<CSN);
-	//Change the SPI Data Order to LSB first and change to Mode 1:1
-	SPCR |= (1<<DORD)|(1<<CPOL)|(1<<CPHA);
+#else
+	SPIBus_Release();
+#endif
 	return;
 }
 
@@ -166,22 +182,32 @@ uint8_t *nRF24L01_Transfer(uint8_t rwt, uint8_t reg, uint8_t *buffer, uint8_t le
 	_delay_us(10); //Be sure the previous command has finished executing
 	nRF24L01_Enable();
 	_delay_us(10);
-	SPI_Transfer(reg); //Set the nRF starts to listen for command
+	nRF24L01_TRANSFER(reg); //Set the nRF starts to listen for command
 	_delay_us(10);
 	
+#ifdef nRF24L01_MSPIM
+	//Stream the data with no gap between bytes
+	if(rwt == READ && reg != W_TX_PAYLOAD){
+		MSPIM_Read(returnBuff, length, NOP);
+	}
+	else{
+		MSPIM_Write(buffer, length);
+	}
+#else
 	uint8_t i;
 	for(i=0; i<length; i++){
 		//If the user wants to read from the receiver
 		if(rwt == READ && reg != W_TX_PAYLOAD){
-			returnBuff[i] = SPI_Transfer(NOP); //Send dummy bytes to read the data
+			returnBuff[i] = nRF24L01_TRANSFER(NOP); //Send dummy bytes to read the data
 			_delay_us(10);
 		}
 		//Send the write data out to the buffer
 		else{
-			SPI_Transfer(buffer[i]); //Send the commands to the nRF one at a time
+			nRF24L01_TRANSFER(buffer[i]); //Send the commands to the nRF one at a time
 			_delay_us(10);
 		}
 	}
+#endif
 	nRF24L01_Disable();
 	//Return 1 to indicate success
 	return returnBuff;
@@ -189,22 +215,22 @@ uint8_t *nRF24L01_Transfer(uint8_t rwt, uint8_t reg, uint8_t *buffer, uint8_t le
 
 void nRF24L01_Reset(){
 	_delay_us(10);
-	PORT_nRF24L01 &= ~(1<<CSN);
+	nRF24L01_Enable();
 	_delay_us(10);
-	SPI_Transfer(W_REGISTER + STATUS); //Write to the status registry
+	nRF24L01_TRANSFER(W_REGISTER + STATUS); //Write to the status registry
 	_delay_us(10);
-	SPI_Transfer(0x70);	//Reset all IRQ in STATUS registry
+	nRF24L01_TRANSFER(0x70);	//Reset all IRQ in STATUS registry
 	_delay_us(10);
-	PORT_nRF24L01 |= (1<<CSN);
+	nRF24L01_Disable();
 }
 
 uint8_t nRF24L01_ReadRegister(uint8_t reg){
 	_delay_us(10); //Be sure the previous command has finished executing
 	nRF24L01_Enable();
 	_delay_us(10);
-	SPI_Transfer(R_REGISTER + reg); //R_REGISTER set the nRF to reading mode (reg is the register to be read)
+	nRF24L01_TRANSFER(R_REGISTER + reg); //R_REGISTER set the nRF to reading mode (reg is the register to be read)
 	_delay_us(10);
-	reg = SPI_Transfer(NOP); //Send a no operation to receive the register contents
+	reg = nRF24L01_TRANSFER(NOP); //Send a no operation to receive the register contents
 	_delay_us(10);
 	nRF24L01_Disable();
 	return reg; //Return the read register
@@ -216,7 +242,11 @@ void nRF24L01_init(uint8_t mode, uint8_t *RX_Address, uint8_t *TX_Address){
 	DDR_nRF24L01 |= (1<<CE)|(1<<CSN)|(0<<IRQ);
 	PORT_nRF24L01 |= (1<<CE)|(1<<CSN)|(0<<IRQ);
 	//Initialize the SPI Connection
-	SPI_init();
+#ifdef nRF24L01_MSPIM
+	MSPIM_init();
+#else
+	SPIBus_init();
+#endif
 	
 	uint8_t buffer[1]; //Buffer for holding set-up data (1 byte wide only needed for set-up)
 	
@@ -269,13 +299,27 @@ void nRF24L01_init(uint8_t mode, uint8_t *RX_Address, uint8_t *TX_Address){
 	return; //Return to call point
 }
 
-//Transmit the buffer given (32 bytes wide)
-void nRF24L01_Transmit(uint8_t *buffer){
-	//Flush the current transmit buffer
+//Schedule a flush and payload load on the shared bus (buffer must stay valid until SPIBus_Service runs)
+uint8_t nRF24L01_QueuePayload(uint8_t *buffer){
+#ifdef nRF24L01_MSPIM
+	//Nothing else uses USART0, load the payload at full clock right away
 	nRF24L01_Transfer(READ, FLUSH_TX, buffer, 0);
-	//Sends the data in buffer to the nRF
 	nRF24L01_Transfer(READ, W_TX_PAYLOAD, buffer, 5); //User read operation since W_TX_PAYLOAD is on the highest byte level in thr nRF
-	
+#else
+	//Both transactions must fit or the payload would be loaded on top of the old one
+	if(SPIBus_Pending() > SPIBUS_QUEUE_SIZE - 3){
+		return 0;
+	}
+	//Flush the current transmit buffer
+	SPIBus_Queue(SPIBUS_NRF, FLUSH_TX, buffer, 0, SPIBUS_WRITE);
+	//Sends the data in buffer to the nRF
+	SPIBus_Queue(SPIBUS_NRF, W_TX_PAYLOAD, buffer, 5, SPIBUS_WRITE);
+#endif
+	return 1;
+}
+
+//Pulse CE to send whatever payload has been loaded
+void nRF24L01_Send(){
 	//Give 10ms after loading the nRF with payload before TX
 	_delay_ms(10);
 	//Pull CE high to transmit the data
@@ -288,6 +332,14 @@ void nRF24L01_Transmit(uint8_t *buffer){
 	_delay_ms(10);
 }
 
+//Transmit the buffer given (32 bytes wide)
+void nRF24L01_Transmit(uint8_t *buffer){
+	//Load the payload right away, then send it
+	nRF24L01_QueuePayload(buffer);
+	SPIBus_Service();
+	nRF24L01_Send();
+}
+
 uint8_t *nRF24L01_Recieve(){
 	uint8_t *buffer = 0x00; //Receive buffer
 	//Set CE high to listen for data
@@ -0,0 +1,224 @@
+//-----------------------------------------------------------------------------
+//
+//  telemetry_csv.cpp
+//
+//  Swallowtail Link Telemetry Converter
+//  Host tool: turns the controller's telemetry stream into CSV
+//
+//  Copyright (c) 2021 Swallowtail Electronics
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sub-license,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Web:    http://tristanluther.com
+//  Email:  tristanluther28@gmail.com
+//
+//-----------------------------------------------------------------------------
+//
+//  Build:
+//    g++ -O2 -o telemetry_csv telemetry_csv.cpp
+//
+//  Usage:
+//    stty -F /dev/ttyUSB0 9600 raw -echo
+//    telemetry_csv [--summary FILE.csv] /dev/ttyUSB0|telemetry.log > packets.csv
+//
+//  Reads the frames Telemetry.h sends out of PD1, resyncs on the sync
+//  bytes and drops anything that fails the CRC. Every packet record
+//  becomes a CSV row on stdout:
+//
+//    seq,arc,plos,max_rt,channel,loop_ms
+//
+//  The counter frames go to --summary as rows of
+//
+//    packets,retries,max_rt,dropped,loop_max_ms,stack_unused
+//
+//  and the last one is printed at the end with the retry histogram and
+//  loss rate per channel, which is what the retry delay/count and the
+//  channel of a venue are picked from. Gaps in seq are packets whose
+//  record found the ring full, the counters still include them.
+//
+//-----------------------------------------------------------------------------
+
+/******************** Includes ***************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "../AnimatorController2.4GHz/Telemetry.h"
+
+/******************** Macros *****************************/
+
+#define CSV_FRAME_MAX 64 //Longest payload accepted before the frame is taken as noise
+#define CSV_CHANNELS 128 //RF_CH is 7 bits
+
+/******************* Globals *****************************/
+
+//Running totals over the whole stream
+struct CsvStats {
+	unsigned records; //Packet records written
+	unsigned summaries; //Counter frames seen
+	unsigned crc_errors; //Frames dropped for a bad CRC
+	unsigned gaps; //Records missing from the sequence
+	unsigned arc[16]; //Packets per retransmission count
+	unsigned channel_packets[CSV_CHANNELS];
+	unsigned channel_max_rt[CSV_CHANNELS];
+	unsigned char last_summary[TELEMETRY_SUMMARY_SIZE];
+};
+
+/******************** Functions **************************/
+
+static unsigned Get16(const unsigned char *p){
+	return p[0] | (p[1] << 8);
+}
+
+static unsigned long Get32(const unsigned char *p){
+	return Get16(p) | ((unsigned long)Get16(p + 2) << 16);
+}
+
+//One packet record: offsets follow TelemetryRecord
+static void Csv_Record(const unsigned char *p, CsvStats &stats, long &next_seq){
+	unsigned seq = Get16(p);
+	unsigned arc = p[2] & 0x0F;
+	unsigned plos = p[3];
+	unsigned max_rt = (p[4] & TELEMETRY_MAX_RT) ? 1 : 0;
+	unsigned channel = p[5] & (CSV_CHANNELS - 1);
+	if(next_seq >= 0 && seq != (unsigned)next_seq){
+		stats.gaps += (seq - next_seq) & 0xFFFF;
+	}
+	next_seq = (seq + 1) & 0xFFFF;
+	printf("%u,%u,%u,%u,%u,%u\n", seq, arc, plos, max_rt, channel, Get16(p + 6));
+	stats.records++;
+	stats.arc[arc]++;
+	stats.channel_packets[channel]++;
+	stats.channel_max_rt[channel] += max_rt;
+}
+
+//One counter frame: offsets follow TelemetrySummary
+static void Csv_Summary(const unsigned char *p, CsvStats &stats, FILE *out){
+	if(out){
+		fprintf(out, "%lu,%lu,%u,%u,%u,%u\n", Get32(p), Get32(p + 4), Get16(p + 8), Get16(p + 10), Get16(p + 12), Get16(p + 14));
+		fflush(out);
+	}
+	memcpy(stats.last_summary, p, TELEMETRY_SUMMARY_SIZE);
+	stats.summaries++;
+}
+
+int main(int argc, char **argv){
+	const char *path = NULL;
+	const char *summary_path = NULL;
+	for(int i=1; i<argc; i++){
+		if(!strcmp(argv[i], "--summary") && i + 1 < argc){
+			summary_path = argv[++i];
+		}
+		else{
+			path = argv[i];
+		}
+	}
+	if(!path){
+		fprintf(stderr, "usage: telemetry_csv [--summary FILE.csv] /dev/ttyUSB0|telemetry.log\n");
+		return 2;
+	}
+	FILE *fp = fopen(path, "rb");
+	if(!fp){
+		perror(path);
+		return 2;
+	}
+	FILE *summary = NULL;
+	if(summary_path){
+		summary = fopen(summary_path, "w");
+		if(!summary){
+			perror(summary_path);
+			return 2;
+		}
+		fprintf(summary, "packets,retries,max_rt,dropped,loop_max_ms,stack_unused\n");
+	}
+
+	CsvStats stats;
+	memset(&stats, 0, sizeof(stats));
+	long next_seq = -1;
+	printf("seq,arc,plos,max_rt,channel,loop_ms\n");
+	std::vector<unsigned char> buf;
+	int c;
+	while((c = fgetc(fp)) != EOF){
+		buf.push_back(c);
+		//Drop bytes until the buffer starts with the sync
+		while(!buf.empty() && (buf[0] != TELEMETRY_SYNC0 || (buf.size() > 1 && buf[1] != TELEMETRY_SYNC1))){
+			buf.erase(buf.begin());
+		}
+		if(buf.size() < TELEMETRY_HEADER_SIZE){
+			continue;
+		}
+		unsigned length = buf[3] | (buf[4] << 8);
+		if(length > CSV_FRAME_MAX){
+			buf.erase(buf.begin());
+			continue;
+		}
+		if(buf.size() < TELEMETRY_HEADER_SIZE + length + 2){
+			continue;
+		}
+		uint16_t crc = TELEMETRY_CRC_INIT;
+		for(unsigned i=2; i<TELEMETRY_HEADER_SIZE + length; i++){
+			crc = Telemetry_CRC(crc, buf[i]);
+		}
+		if((buf[TELEMETRY_HEADER_SIZE + length] | (buf[TELEMETRY_HEADER_SIZE + length + 1] << 8)) != crc){
+			//Noise that looked like a sync, look for the next one inside it
+			stats.crc_errors++;
+			buf.erase(buf.begin());
+			continue;
+		}
+		const unsigned char *p = &buf[TELEMETRY_HEADER_SIZE];
+		if(buf[2] == TELEMETRY_TYPE_PACKET && length == TELEMETRY_RECORD_SIZE){
+			Csv_Record(p, stats, next_seq);
+		}
+		else if(buf[2] == TELEMETRY_TYPE_SUMMARY && length == TELEMETRY_SUMMARY_SIZE){
+			Csv_Summary(p, stats, summary);
+		}
+		buf.erase(buf.begin(), buf.begin() + TELEMETRY_HEADER_SIZE + length + 2);
+		fflush(stdout);
+	}
+	fclose(fp);
+	if(summary){
+		fclose(summary);
+	}
+
+	fprintf(stderr, "%u records, %u counter frames, %u CRC errors, %u records not sent by the controller\n",
+		stats.records, stats.summaries, stats.crc_errors, stats.gaps);
+	if(stats.summaries){
+		const unsigned char *s = stats.last_summary;
+		unsigned long packets = Get32(s);
+		fprintf(stderr, "controller: %lu packets, %.2f retries per packet, %u given up, longest loop %u ms, %u bytes SRAM never used\n",
+			packets, packets ? (double)Get32(s + 4) / packets : 0.0, Get16(s + 8), Get16(s + 12), Get16(s + 14));
+	}
+	if(stats.records){
+		fprintf(stderr, "retries:");
+		for(int i=0; i<16; i++){
+			if(stats.arc[i]){
+				fprintf(stderr, " %d:%.1f%%", i, 100.0 * stats.arc[i] / stats.records);
+			}
+		}
+		fprintf(stderr, "\n");
+		for(int ch=0; ch<CSV_CHANNELS; ch++){
+			if(stats.channel_packets[ch]){
+				fprintf(stderr, "channel %d (%d MHz): %u packets, %.1f%% given up\n", ch, 2400 + ch,
+					stats.channel_packets[ch], 100.0 * stats.channel_max_rt[ch] / stats.channel_packets[ch]);
+			}
+		}
+	}
+	return 0;
+}